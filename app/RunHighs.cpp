@@ -14,6 +14,7 @@
 #include "Highs.h"
 // #include "io/HighsIO.h"
 #include "lp_data/HighsRuntimeOptions.h"
+#include "parallel/HighsParallel.h"
 
 void reportModelStatsOrError(const HighsLogOptions& log_options,
                              const HighsStatus read_status,
@@ -28,6 +29,7 @@ int main(int argc, char** argv) {
   // Load user options
   std::string model_file;
   std::string read_solution_file;
+  HighsPerfSuiteSettings perf_suite_settings;
   HighsOptions loaded_options;
   // Set "HiGHS.log" as the default log_file for the app so that
   // log_file has this value if it isn't set in the file
@@ -35,7 +37,7 @@ int main(int argc, char** argv) {
   // When loading the options file, any messages are reported using
   // the default HighsLogOptions
   if (!loadOptions(log_options, argc, argv, loaded_options, model_file,
-                   read_solution_file))
+                   read_solution_file, perf_suite_settings))
     return (int)HighsStatus::kError;
   // Open the app log file - unless output_flag is false, to avoid
   // creating an empty file. It does nothing if its name is "".
@@ -48,6 +50,16 @@ int main(int argc, char** argv) {
   highs.passOptions(loaded_options);
   //  highs.writeOptions("Options.md");
 
+  // Start the global scheduler with the number of threads that run()
+  // will use, so that it is available when reading the model
+  highs::parallel::initialize_scheduler(
+      loaded_options.threads, Highs::schedulerConfig(loaded_options));
+
+  // Solve the models in a performance suite and/or compare
+  // performance reports, rather than solving model_file
+  if (perf_suite_settings.active())
+    return (int)runPerfSuite(perf_suite_settings, highs.getOptions());
+
   // Load the model from model_file
   HighsStatus read_status = highs.readModel(model_file);
   reportModelStatsOrError(log_options, read_status, highs.getModel());
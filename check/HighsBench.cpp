@@ -0,0 +1,931 @@
+// Benchmarks of the computational kernels of HiGHS, and of solving the
+// LP and MIP models in check/instances.
+//
+// Each benchmark is run for at least --benchmark_min_time seconds, and
+// the mean real and CPU time per iteration is reported. The command
+// line options and the JSON written by --benchmark_out follow Google
+// Benchmark, so that its tools - compare.py in particular - can be
+// used to compare the results of two builds.
+//
+//   highs_bench [--benchmark_filter=<regex>] [--benchmark_min_time=<s>]
+//               [--benchmark_repetitions=<n>] [--benchmark_out=<file>]
+//               [--benchmark_format=console|json] [--benchmark_list_tests]
+//               [--instance_dir=<dir>]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HCheckConfig.h"
+#include "Highs.h"
+#include "mip/HighsCliqueTable.h"
+#include "mip/HighsDomain.h"
+#include "mip/HighsMipSolver.h"
+#include "mip/HighsMipSolverData.h"
+#include "simplex/HEkk.h"
+#include "simplex/HEkkDualRow.h"
+#include "util/HFactor.h"
+#include "util/HighsHash.h"
+#include "util/HighsRandom.h"
+#include "util/HighsSparseMatrix.h"
+
+namespace {
+
+std::string instance_dir = std::string(HIGHS_DIR) + "/check/instances";
+
+// Models used for the end-to-end timings, as in the instance tests
+// of check/CMakeLists.txt
+const std::vector<std::string> kLpModels = {
+    "25fv47", "80bau3b", "adlittle", "afiro",   "etamacro",
+    "greenbea", "shell", "stair",    "standata"};
+const std::vector<std::string> kMipModels = {
+    "small_mip", "flugpl", "lseu",       "egout", "gt2",
+    "rgn",       "bell5",  "sp150x300d", "p0548", "dcmulti"};
+
+// Models used for the simplex kernels and the MIP kernels
+const std::vector<std::string> kSimplexKernelModels = {"25fv47", "80bau3b",
+                                                       "greenbea"};
+const std::vector<std::string> kMipKernelModels = {"lseu", "p0548",
+                                                   "dcmulti"};
+
+// Number of distinct right-hand sides, rows or queries that the
+// kernel benchmarks cycle through
+const HighsInt kNumBenchVector = 100;
+const HighsInt kNumHashKey = 1 << 12;
+const HighsInt kNumCliqueQuery = 1 << 12;
+
+class BenchState {
+ public:
+  explicit BenchState(const double min_time) : min_time_(min_time) {}
+
+  // Returns true while the timed loop should continue. The clock
+  // starts at the first call, so set-up before the loop is not timed
+  bool keepRunning() {
+    if (!started_) {
+      if (!error_message_.empty()) return false;
+      started_ = true;
+      wall_start_ = std::chrono::steady_clock::now();
+      cpu_start_ = std::clock();
+      return true;
+    }
+    num_iteration_++;
+    const double wall_time =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      wall_start_)
+            .count();
+    if (wall_time < min_time_) return true;
+    wall_time_ = wall_time;
+    cpu_time_ = double(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+    return false;
+  }
+
+  int64_t iterations() const { return num_iteration_; }
+  double wallTime() const { return wall_time_; }
+  double cpuTime() const { return cpu_time_; }
+
+  void setCounter(const std::string& name, const double value) {
+    counters_[name] = value;
+  }
+  void setItemsProcessed(const int64_t num_item) {
+    num_item_processed_ = num_item;
+  }
+  int64_t itemsProcessed() const { return num_item_processed_; }
+  const std::map<std::string, double>& counters() const { return counters_; }
+
+  // Reports an error from set-up, after which keepRunning() returns
+  // false
+  void skipWithError(const std::string& message) { error_message_ = message; }
+  const std::string& errorMessage() const { return error_message_; }
+
+ private:
+  double min_time_;
+  bool started_ = false;
+  int64_t num_iteration_ = 0;
+  std::chrono::steady_clock::time_point wall_start_;
+  std::clock_t cpu_start_ = 0;
+  double wall_time_ = 0;
+  double cpu_time_ = 0;
+  int64_t num_item_processed_ = 0;
+  std::map<std::string, double> counters_;
+  std::string error_message_;
+};
+
+struct Benchmark {
+  std::string name;
+  std::string time_unit;
+  std::function<void(BenchState&)> function;
+};
+
+struct BenchRun {
+  std::string name;
+  std::string run_type;
+  std::string aggregate_name;
+  HighsInt family_index;
+  HighsInt repetition_index;
+  int64_t iterations;
+  double real_time;
+  double cpu_time;
+  std::string time_unit;
+  std::map<std::string, double> counters;
+  std::string error_message;
+};
+
+std::vector<Benchmark>& benchmarks() {
+  static std::vector<Benchmark> registered;
+  return registered;
+}
+
+void registerBenchmark(const std::string& name, const std::string& time_unit,
+                       std::function<void(BenchState&)> function) {
+  benchmarks().push_back({name, time_unit, std::move(function)});
+}
+
+double timeUnitMultiplier(const std::string& time_unit) {
+  if (time_unit == "ms") return 1e3;
+  if (time_unit == "us") return 1e6;
+  return 1e9;
+}
+
+std::string instanceFile(const std::string& model) {
+  return instance_dir + "/" + model + ".mps";
+}
+
+// Running average of the density of results, as maintained by HEkk
+// to choose between hyper-sparse and standard solves
+void updateDensity(const double local_density, double& density) {
+  density = (1 - kRunningAverageMultiplier) * density +
+            kRunningAverageMultiplier * local_density;
+}
+
+// An LP with its optimal basis, read and solved once for all the
+// benchmarks that use it
+struct BenchLp {
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  std::vector<HighsInt> basic_index;
+};
+
+std::shared_ptr<const BenchLp> getSolvedLp(const std::string& model) {
+  static std::map<std::string, std::shared_ptr<const BenchLp>> solved;
+  auto it = solved.find(model);
+  if (it != solved.end()) return it->second;
+  std::shared_ptr<BenchLp> bench_lp;
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  // Without presolve, the basis is for the LP as read
+  highs.setOptionValue("presolve", kHighsOffString);
+  if (highs.readModel(instanceFile(model)) == HighsStatus::kOk &&
+      highs.run() == HighsStatus::kOk &&
+      highs.getModelStatus() == HighsModelStatus::kOptimal) {
+    bench_lp = std::make_shared<BenchLp>();
+    bench_lp->lp = highs.getLp();
+    bench_lp->basis = highs.getBasis();
+    bench_lp->solution = highs.getSolution();
+    const HighsInt num_col = bench_lp->lp.num_col_;
+    const HighsInt num_row = bench_lp->lp.num_row_;
+    bench_lp->basic_index.resize(num_row);
+    highs.getBasicVariables(bench_lp->basic_index.data());
+    // Basic slacks are returned as -(row+1), but HFactor indexes them
+    // as num_col+row
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      HighsInt& iVar = bench_lp->basic_index[iRow];
+      if (iVar < 0) iVar = num_col - iVar - 1;
+    }
+  }
+  solved[model] = bench_lp;
+  return bench_lp;
+}
+
+std::shared_ptr<const HighsLp> getModel(const std::string& model) {
+  static std::map<std::string, std::shared_ptr<const HighsLp>> models;
+  auto it = models.find(model);
+  if (it != models.end()) return it->second;
+  std::shared_ptr<const HighsLp> lp;
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  if (highs.readModel(instanceFile(model)) != HighsStatus::kError)
+    lp = std::make_shared<const HighsLp>(highs.getLp());
+  models[model] = lp;
+  return lp;
+}
+
+// Sets up and factors the optimal basis matrix, returning false if it
+// is singular
+bool buildFactor(const BenchLp& bench_lp, std::vector<HighsInt>& basic_index,
+                 HFactor& factor) {
+  basic_index = bench_lp.basic_index;
+  factor.setup(bench_lp.lp.a_matrix_, basic_index);
+  return factor.build() == 0;
+}
+
+// Forms rows of B^{-1} (row_ep) and B^{-1}A (row_ap) for rows spread
+// over the basis matrix
+void formTableauRows(const BenchLp& bench_lp, const HFactor& factor,
+                     std::vector<HVector>& row_ep,
+                     std::vector<HVector>& row_ap) {
+  const HighsLp& lp = bench_lp.lp;
+  HighsSparseMatrix ar_matrix;
+  ar_matrix.createRowwise(lp.a_matrix_);
+  const HighsInt num_vector = std::min(kNumBenchVector, lp.num_row_);
+  row_ep.resize(num_vector);
+  row_ap.resize(num_vector);
+  for (HighsInt iVector = 0; iVector < num_vector; iVector++) {
+    const HighsInt iRow = (iVector * lp.num_row_) / num_vector;
+    row_ep[iVector].setup(lp.num_row_);
+    row_ep[iVector].clear();
+    row_ep[iVector].count = 1;
+    row_ep[iVector].index[0] = iRow;
+    row_ep[iVector].array[iRow] = 1;
+    factor.btranCall(row_ep[iVector], 1);
+    row_ap[iVector].setup(lp.num_col_);
+    row_ap[iVector].clear();
+    ar_matrix.priceByRow(false, row_ap[iVector], row_ep[iVector]);
+  }
+}
+
+void benchFactorBuild(BenchState& state, const std::string& model) {
+  std::shared_ptr<const BenchLp> bench_lp = getSolvedLp(model);
+  if (!bench_lp) return state.skipWithError("Cannot solve " + model);
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  if (!buildFactor(*bench_lp, basic_index, factor))
+    return state.skipWithError("Singular basis matrix");
+  while (state.keepRunning()) factor.build();
+  state.setCounter("num_row", bench_lp->lp.num_row_);
+}
+
+void benchFactorFtran(BenchState& state, const std::string& model) {
+  std::shared_ptr<const BenchLp> bench_lp = getSolvedLp(model);
+  if (!bench_lp) return state.skipWithError("Cannot solve " + model);
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  if (!buildFactor(*bench_lp, basic_index, factor))
+    return state.skipWithError("Singular basis matrix");
+  const HighsLp& lp = bench_lp->lp;
+  // Solve with the columns of nonbasic structurals, as in the
+  // FTRAN of the pivotal column
+  std::vector<HighsInt> nonbasic_col;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    if (bench_lp->basis.col_status[iCol] != HighsBasisStatus::kBasic)
+      nonbasic_col.push_back(iCol);
+  if (nonbasic_col.empty())
+    return state.skipWithError("No nonbasic structural columns");
+  HVector column;
+  column.setup(lp.num_row_);
+  double density = 1;
+  size_t next_col = 0;
+  while (state.keepRunning()) {
+    column.clear();
+    lp.a_matrix_.collectAj(column, nonbasic_col[next_col], 1);
+    factor.ftranCall(column, density);
+    updateDensity(double(column.count) / lp.num_row_, density);
+    if (++next_col == nonbasic_col.size()) next_col = 0;
+  }
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("density", density);
+}
+
+void benchFactorBtran(BenchState& state, const std::string& model) {
+  std::shared_ptr<const BenchLp> bench_lp = getSolvedLp(model);
+  if (!bench_lp) return state.skipWithError("Cannot solve " + model);
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  if (!buildFactor(*bench_lp, basic_index, factor))
+    return state.skipWithError("Singular basis matrix");
+  const HighsInt num_row = bench_lp->lp.num_row_;
+  // Solve with unit vectors, as in the BTRAN of the pivotal row
+  HVector row;
+  row.setup(num_row);
+  double density = 1;
+  HighsInt next_row = 0;
+  while (state.keepRunning()) {
+    row.clear();
+    row.count = 1;
+    row.index[0] = next_row;
+    row.array[next_row] = 1;
+    factor.btranCall(row, density);
+    updateDensity(double(row.count) / num_row, density);
+    if (++next_row == num_row) next_row = 0;
+  }
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("density", density);
+}
+
+enum class PriceMethod { kByColumn, kByRow, kByRowWithSwitch };
+
+void benchPrice(BenchState& state, const std::string& model,
+                const PriceMethod method) {
+  std::shared_ptr<const BenchLp> bench_lp = getSolvedLp(model);
+  if (!bench_lp) return state.skipWithError("Cannot solve " + model);
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  if (!buildFactor(*bench_lp, basic_index, factor))
+    return state.skipWithError("Singular basis matrix");
+  const HighsLp& lp = bench_lp->lp;
+  std::vector<HVector> row_ep;
+  std::vector<HVector> row_ap;
+  formTableauRows(*bench_lp, factor, row_ep, row_ap);
+  HighsSparseMatrix ar_matrix;
+  ar_matrix.createRowwise(lp.a_matrix_);
+  HVector result;
+  result.setup(lp.num_col_);
+  double density = 1;
+  size_t next_row = 0;
+  while (state.keepRunning()) {
+    result.clear();
+    switch (method) {
+      case PriceMethod::kByColumn:
+        lp.a_matrix_.priceByColumn(false, result, row_ep[next_row]);
+        break;
+      case PriceMethod::kByRow:
+        ar_matrix.priceByRow(false, result, row_ep[next_row]);
+        break;
+      case PriceMethod::kByRowWithSwitch:
+        ar_matrix.priceByRowWithSwitch(false, result, row_ep[next_row],
+                                       density, 0, kHyperPriceDensity);
+        break;
+    }
+    updateDensity(double(result.count) / lp.num_col_, density);
+    if (++next_row == row_ep.size()) next_row = 0;
+  }
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("density", density);
+}
+
+// CHUZC of the dual simplex for pivotal rows of the optimal basis. The
+// HEkk instance is given only the data that HEkkDualRow uses. As in
+// HEkkDual::chooseColumn, the candidates are packed and filtered by
+// choosePossible() before chooseFinal()
+void benchChooseFinal(BenchState& state, const std::string& model) {
+  std::shared_ptr<const BenchLp> bench_lp = getSolvedLp(model);
+  if (!bench_lp) return state.skipWithError("Cannot solve " + model);
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  if (!buildFactor(*bench_lp, basic_index, factor))
+    return state.skipWithError("Singular basis matrix");
+  const HighsLp& lp = bench_lp->lp;
+  const HighsBasis& basis = bench_lp->basis;
+  const HighsSolution& solution = bench_lp->solution;
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_tot = lp.num_col_ + lp.num_row_;
+
+  HighsOptions options;
+  HEkk ekk;
+  ekk.options_ = &options;
+  ekk.lp_ = lp;
+  ekk.analysis_.analyse_simplex_time = false;
+  ekk.basis_.nonbasicFlag_.assign(num_tot, kNonbasicFlagFalse);
+  ekk.basis_.nonbasicMove_.assign(num_tot, kNonbasicMoveZe);
+  ekk.info_.workDual_.assign(num_tot, 0);
+  ekk.info_.workRange_.resize(num_tot);
+  ekk.info_.devex_index_.assign(num_tot, 1);
+  ekk.info_.numTotPermutation_.resize(num_tot);
+  ekk.info_.update_count = 0;
+  for (HighsInt iVar = 0; iVar < num_tot; iVar++) {
+    ekk.info_.numTotPermutation_[iVar] = iVar;
+    const bool is_col = iVar < num_col;
+    const HighsInt iRow = iVar - num_col;
+    const HighsBasisStatus status =
+        is_col ? basis.col_status[iVar] : basis.row_status[iRow];
+    const double lower = is_col ? lp.col_lower_[iVar] : lp.row_lower_[iRow];
+    const double upper = is_col ? lp.col_upper_[iVar] : lp.row_upper_[iRow];
+    const double dual =
+        is_col ? solution.col_dual[iVar] : solution.row_dual[iRow];
+    ekk.info_.workRange_[iVar] = upper - lower;
+    if (status == HighsBasisStatus::kBasic) continue;
+    ekk.basis_.nonbasicFlag_[iVar] = kNonbasicFlagTrue;
+    if (lower == upper) continue;
+    // Logicals in HEkk have the negated bounds of their rows
+    HighsInt move = kNonbasicMoveZe;
+    if (status == HighsBasisStatus::kLower) {
+      move = is_col ? kNonbasicMoveUp : kNonbasicMoveDn;
+    } else if (status == HighsBasisStatus::kUpper) {
+      move = is_col ? kNonbasicMoveDn : kNonbasicMoveUp;
+    }
+    ekk.basis_.nonbasicMove_[iVar] = move;
+    // The duals are feasible at the optimal basis
+    ekk.info_.workDual_[iVar] = move * std::fabs(dual);
+  }
+
+  std::vector<HVector> row_ep;
+  std::vector<HVector> row_ap;
+  formTableauRows(*bench_lp, factor, row_ep, row_ap);
+  HEkkDualRow dual_row(ekk);
+  dual_row.setup();
+  auto chooseColumn = [&](const HighsInt iVector) {
+    dual_row.clear();
+    dual_row.workDelta = iVector % 2 ? -1 : 1;
+    dual_row.chooseMakepack(&row_ap[iVector], 0);
+    dual_row.chooseMakepack(&row_ep[iVector], num_col);
+    dual_row.choosePossible();
+    if (dual_row.workCount == 0) return -1;
+    return dual_row.chooseFinal();
+  };
+  // Use only the rows for which CHUZC finds an entering variable
+  std::vector<HighsInt> use_vector;
+  for (HighsInt iVector = 0; iVector < (HighsInt)row_ep.size(); iVector++)
+    if (chooseColumn(iVector) == 0 && dual_row.workPivot >= 0)
+      use_vector.push_back(iVector);
+  if (use_vector.empty())
+    return state.skipWithError("No rows with entering variables");
+  size_t next_vector = 0;
+  while (state.keepRunning()) {
+    chooseColumn(use_vector[next_vector]);
+    if (++next_vector == use_vector.size()) next_vector = 0;
+  }
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("num_row_used", use_vector.size());
+}
+
+// A MIP after presolve and set-up, ready for the search to start
+struct BenchMip {
+  HighsLp lp;
+  HighsOptions options;
+  HighsCallback callback;
+  HighsSolution solution;
+  std::unique_ptr<HighsMipSolver> solver;
+};
+
+std::shared_ptr<BenchMip> getSetupMip(const std::string& model) {
+  static std::map<std::string, std::shared_ptr<BenchMip>> setup;
+  auto it = setup.find(model);
+  if (it != setup.end()) return it->second;
+  std::shared_ptr<BenchMip> bench_mip;
+  std::shared_ptr<const HighsLp> lp = getModel(model);
+  if (lp) {
+    bench_mip = std::make_shared<BenchMip>();
+    bench_mip->lp = *lp;
+    bench_mip->options.output_flag = false;
+    bench_mip->callback.clear();
+    bench_mip->solver.reset(
+        new HighsMipSolver(bench_mip->callback, bench_mip->options,
+                           bench_mip->lp, bench_mip->solution));
+    HighsMipSolver& solver = *bench_mip->solver;
+    solver.timer_.start(solver.timer_.solve_clock);
+    solver.runPresolve();
+    if (solver.modelstatus_ == HighsModelStatus::kNotset)
+      solver.mipdata_->runSetup();
+    // The search is needed only if neither presolve nor set-up has
+    // solved the MIP
+    if (solver.modelstatus_ != HighsModelStatus::kNotset) bench_mip = nullptr;
+  }
+  setup[model] = bench_mip;
+  return bench_mip;
+}
+
+// Propagation after branching on each integer column in turn, as in
+// the tree search
+void benchPropagate(BenchState& state, const std::string& model) {
+  std::shared_ptr<BenchMip> bench_mip = getSetupMip(model);
+  if (!bench_mip) return state.skipWithError("Cannot set up " + model);
+  const HighsMipSolverData& mipdata = *bench_mip->solver->mipdata_;
+  HighsDomain domain = mipdata.domain;
+  std::vector<HighsInt> branch_col;
+  for (HighsInt iCol : mipdata.integral_cols)
+    if (domain.col_lower_[iCol] < domain.col_upper_[iCol])
+      branch_col.push_back(iCol);
+  if (branch_col.empty()) return state.skipWithError("No integer columns");
+  int64_t num_infeasible = 0;
+  size_t next_col = 0;
+  bool branch_up = false;
+  while (state.keepRunning()) {
+    const HighsInt iCol = branch_col[next_col];
+    if (branch_up)
+      domain.changeBound(HighsBoundType::kLower, iCol,
+                         domain.col_lower_[iCol] + 1);
+    else
+      domain.changeBound(HighsBoundType::kUpper, iCol,
+                         domain.col_lower_[iCol]);
+    domain.propagate();
+    if (domain.infeasible()) num_infeasible++;
+    domain.backtrack();
+    domain.clearChangedCols();
+    if (++next_col == branch_col.size()) {
+      next_col = 0;
+      branch_up = !branch_up;
+    }
+  }
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("num_infeasible", num_infeasible);
+}
+
+// Queries for the clique containing each of many random pairs of
+// binary literals
+void benchFindCommonClique(BenchState& state, const std::string& model) {
+  std::shared_ptr<BenchMip> bench_mip = getSetupMip(model);
+  if (!bench_mip) return state.skipWithError("Cannot set up " + model);
+  HighsMipSolverData& mipdata = *bench_mip->solver->mipdata_;
+  HighsCliqueTable& cliquetable = mipdata.cliquetable;
+  std::vector<HighsInt> binary_col;
+  for (HighsInt iCol : mipdata.integral_cols)
+    if (mipdata.domain.isBinary(iCol)) binary_col.push_back(iCol);
+  if (binary_col.size() < 2) return state.skipWithError("No binary columns");
+  HighsRandom random;
+  std::vector<HighsCliqueTable::CliqueVar> query(2 * kNumCliqueQuery);
+  for (HighsInt iQuery = 0; iQuery < 2 * kNumCliqueQuery; iQuery++)
+    query[iQuery] = HighsCliqueTable::CliqueVar(
+        binary_col[random.integer(binary_col.size())], random.integer(2));
+  int64_t num_found = 0;
+  while (state.keepRunning()) {
+    for (HighsInt iQuery = 0; iQuery < kNumCliqueQuery; iQuery++)
+      if (cliquetable
+              .findCommonClique(query[2 * iQuery], query[2 * iQuery + 1])
+              .first)
+        num_found++;
+  }
+  state.setItemsProcessed(state.iterations() * kNumCliqueQuery);
+  state.setCounter("num_clique", cliquetable.numCliques());
+  state.setCounter("num_found", num_found);
+}
+
+std::vector<uint64_t> randomKeys(const HighsInt num_key) {
+  HighsRandom random;
+  std::vector<uint64_t> keys(num_key);
+  for (uint64_t& key : keys)
+    key = (uint64_t(random.integer()) << 32) ^ uint64_t(random.integer());
+  return keys;
+}
+
+void benchHashTableInsert(BenchState& state) {
+  const std::vector<uint64_t> keys = randomKeys(kNumHashKey);
+  while (state.keepRunning()) {
+    HighsHashTable<uint64_t, HighsInt> table;
+    for (HighsInt iKey = 0; iKey < kNumHashKey; iKey++)
+      table.insert(keys[iKey], iKey);
+  }
+  state.setItemsProcessed(state.iterations() * kNumHashKey);
+}
+
+// Lookups of which half are for keys that are not in the table
+void benchHashTableFind(BenchState& state) {
+  const std::vector<uint64_t> keys = randomKeys(2 * kNumHashKey);
+  HighsHashTable<uint64_t, HighsInt> table;
+  for (HighsInt iKey = 0; iKey < kNumHashKey; iKey++)
+    table.insert(keys[iKey], iKey);
+  int64_t num_found = 0;
+  while (state.keepRunning()) {
+    for (HighsInt iKey = 0; iKey < 2 * kNumHashKey; iKey++)
+      if (table.find(keys[iKey])) num_found++;
+  }
+  state.setItemsProcessed(state.iterations() * 2 * kNumHashKey);
+  state.setCounter("num_found", num_found);
+}
+
+void benchSolve(BenchState& state, const std::string& model) {
+  std::shared_ptr<const HighsLp> lp = getModel(model);
+  if (!lp) return state.skipWithError("Cannot read " + model);
+  HighsInfo info;
+  while (state.keepRunning()) {
+    Highs highs;
+    highs.setOptionValue("output_flag", false);
+    highs.passModel(*lp);
+    if (highs.run() != HighsStatus::kOk ||
+        highs.getModelStatus() != HighsModelStatus::kOptimal)
+      return state.skipWithError("Not solved to optimality");
+    info = highs.getInfo();
+  }
+  state.setCounter("objective", info.objective_function_value);
+  state.setCounter("simplex_iteration_count", info.simplex_iteration_count);
+  if (info.mip_node_count >= 0)
+    state.setCounter("mip_node_count", info.mip_node_count);
+}
+
+void registerBenchmarks() {
+  for (const std::string& model : kSimplexKernelModels) {
+    registerBenchmark("HFactor::build/" + model, "us",
+                      [model](BenchState& state) {
+                        benchFactorBuild(state, model);
+                      });
+    registerBenchmark("HFactor::ftranCall/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchFactorFtran(state, model);
+                      });
+    registerBenchmark("HFactor::btranCall/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchFactorBtran(state, model);
+                      });
+    registerBenchmark("HighsSparseMatrix::priceByColumn/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchPrice(state, model, PriceMethod::kByColumn);
+                      });
+    registerBenchmark("HighsSparseMatrix::priceByRow/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchPrice(state, model, PriceMethod::kByRow);
+                      });
+    registerBenchmark(
+        "HighsSparseMatrix::priceByRowWithSwitch/" + model, "ns",
+        [model](BenchState& state) {
+          benchPrice(state, model, PriceMethod::kByRowWithSwitch);
+        });
+    registerBenchmark("HEkkDualRow::chooseFinal/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchChooseFinal(state, model);
+                      });
+  }
+  for (const std::string& model : kMipKernelModels) {
+    registerBenchmark("HighsDomain::propagate/" + model, "ns",
+                      [model](BenchState& state) {
+                        benchPropagate(state, model);
+                      });
+    registerBenchmark("HighsCliqueTable::findCommonClique/" + model, "us",
+                      [model](BenchState& state) {
+                        benchFindCommonClique(state, model);
+                      });
+  }
+  registerBenchmark("HighsHashTable::insert", "us", benchHashTableInsert);
+  registerBenchmark("HighsHashTable::find", "us", benchHashTableFind);
+  for (const std::string& model : kLpModels)
+    registerBenchmark("Solve/lp/" + model, "ms", [model](BenchState& state) {
+      benchSolve(state, model);
+    });
+  for (const std::string& model : kMipModels)
+    registerBenchmark("Solve/mip/" + model, "ms", [model](BenchState& state) {
+      benchSolve(state, model);
+    });
+}
+
+BenchRun runBenchmark(const Benchmark& benchmark, const double min_time) {
+  BenchState state(min_time);
+  benchmark.function(state);
+  BenchRun run;
+  run.name = benchmark.name;
+  run.run_type = "iteration";
+  run.time_unit = benchmark.time_unit;
+  run.iterations = state.iterations();
+  run.error_message = state.errorMessage();
+  run.counters = state.counters();
+  run.real_time = 0;
+  run.cpu_time = 0;
+  if (run.iterations > 0) {
+    const double multiplier = timeUnitMultiplier(run.time_unit);
+    run.real_time = multiplier * state.wallTime() / run.iterations;
+    run.cpu_time = multiplier * state.cpuTime() / run.iterations;
+    if (state.itemsProcessed() > 0 && state.wallTime() > 0)
+      run.counters["items_per_second"] =
+          state.itemsProcessed() / state.wallTime();
+  }
+  return run;
+}
+
+// The mean, median and standard deviation over repetitions of the
+// times and counters
+std::vector<BenchRun> aggregateRuns(const std::vector<BenchRun>& runs) {
+  std::vector<BenchRun> aggregates;
+  const HighsInt num_run = runs.size();
+  const std::vector<std::string> names = {"mean", "median", "stddev"};
+  auto aggregate = [&](const std::string& name,
+                       std::vector<double> values) -> double {
+    double mean = 0;
+    for (double value : values) mean += value;
+    mean /= num_run;
+    if (name == "mean") return mean;
+    if (name == "median") {
+      std::sort(values.begin(), values.end());
+      return num_run % 2 ? values[num_run / 2]
+                         : 0.5 * (values[num_run / 2 - 1] +
+                                  values[num_run / 2]);
+    }
+    if (num_run < 2) return 0;
+    double sum_square = 0;
+    for (double value : values) sum_square += (value - mean) * (value - mean);
+    return std::sqrt(sum_square / (num_run - 1));
+  };
+  for (const std::string& name : names) {
+    BenchRun run = runs[0];
+    run.name = runs[0].name + "_" + name;
+    run.run_type = "aggregate";
+    run.aggregate_name = name;
+    run.iterations = num_run;
+    std::vector<double> real_time;
+    std::vector<double> cpu_time;
+    for (const BenchRun& repetition : runs) {
+      real_time.push_back(repetition.real_time);
+      cpu_time.push_back(repetition.cpu_time);
+    }
+    run.real_time = aggregate(name, real_time);
+    run.cpu_time = aggregate(name, cpu_time);
+    for (auto& counter : run.counters) {
+      std::vector<double> values;
+      for (const BenchRun& repetition : runs)
+        values.push_back(repetition.counters.at(counter.first));
+      counter.second = aggregate(name, values);
+    }
+    aggregates.push_back(run);
+  }
+  return aggregates;
+}
+
+std::string jsonString(const std::string& value) {
+  std::string quoted = "\"";
+  for (char c : value) {
+    if (c == '"' || c == '\\') quoted += '\\';
+    quoted += c;
+  }
+  return quoted + "\"";
+}
+
+void writeJson(std::ostream& os, const std::vector<BenchRun>& runs,
+               const HighsInt num_repetition, const char* executable) {
+  char date[64];
+  const std::time_t now = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z",
+                std::localtime(&now));
+  os.precision(17);
+  os << "{\n  \"context\": {\n"
+     << "    \"date\": " << jsonString(date) << ",\n"
+     << "    \"executable\": " << jsonString(executable) << ",\n"
+     << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+     << "    \"highs_version\": " << jsonString(highsVersion()) << ",\n"
+     << "    \"highs_githash\": " << jsonString(highsGithash()) << ",\n"
+#ifdef NDEBUG
+     << "    \"library_build_type\": \"release\"\n"
+#else
+     << "    \"library_build_type\": \"debug\"\n"
+#endif
+     << "  },\n  \"benchmarks\": [";
+  for (size_t iRun = 0; iRun < runs.size(); iRun++) {
+    const BenchRun& run = runs[iRun];
+    const std::string run_name =
+        run.run_type == "aggregate"
+            ? run.name.substr(0, run.name.size() - run.aggregate_name.size() -
+                                     1)
+            : run.name;
+    os << (iRun ? ",\n" : "\n") << "    {\n"
+       << "      \"name\": " << jsonString(run.name) << ",\n"
+       << "      \"family_index\": " << run.family_index << ",\n"
+       << "      \"per_family_instance_index\": 0,\n"
+       << "      \"run_name\": " << jsonString(run_name) << ",\n"
+       << "      \"run_type\": " << jsonString(run.run_type) << ",\n"
+       << "      \"repetitions\": " << num_repetition << ",\n";
+    if (run.run_type == "aggregate")
+      os << "      \"aggregate_name\": " << jsonString(run.aggregate_name)
+         << ",\n";
+    else
+      os << "      \"repetition_index\": " << run.repetition_index << ",\n";
+    os << "      \"threads\": 1,\n";
+    if (!run.error_message.empty())
+      os << "      \"error_occurred\": true,\n"
+         << "      \"error_message\": " << jsonString(run.error_message)
+         << ",\n";
+    os << "      \"iterations\": " << run.iterations << ",\n"
+       << "      \"real_time\": " << run.real_time << ",\n"
+       << "      \"cpu_time\": " << run.cpu_time << ",\n"
+       << "      \"time_unit\": " << jsonString(run.time_unit);
+    for (const auto& counter : run.counters)
+      os << ",\n      " << jsonString(counter.first) << ": " << counter.second;
+    os << "\n    }";
+  }
+  os << "\n  ]\n}\n";
+}
+
+void reportRun(const BenchRun& run, const HighsInt name_width) {
+  if (!run.error_message.empty()) {
+    printf("%-*s ERROR: %s\n", (int)name_width, run.name.c_str(),
+           run.error_message.c_str());
+    return;
+  }
+  printf("%-*s %11.4g %-2s %11.4g %-2s %11lld", (int)name_width,
+         run.name.c_str(), run.real_time, run.time_unit.c_str(),
+         run.cpu_time, run.time_unit.c_str(), (long long)run.iterations);
+  for (const auto& counter : run.counters)
+    printf(" %s=%g", counter.first.c_str(), counter.second);
+  printf("\n");
+  fflush(stdout);
+}
+
+bool parseOption(const std::string& arg, const std::string& name,
+                 std::string& value) {
+  const std::string prefix = "--" + name + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+  value = arg.substr(prefix.size());
+  return true;
+}
+
+void printUsage(const char* executable) {
+  printf(
+      "usage: %s [--benchmark_filter=<regex>] [--benchmark_min_time=<s>]\n"
+      "          [--benchmark_repetitions=<n>] [--benchmark_out=<file>]\n"
+      "          [--benchmark_format=console|json] [--benchmark_list_tests]\n"
+      "          [--instance_dir=<dir>]\n",
+      executable);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string filter = ".";
+  double min_time = 0.5;
+  HighsInt num_repetition = 1;
+  std::string out_file;
+  std::string format = "console";
+  bool list_tests = false;
+  for (int iArg = 1; iArg < argc; iArg++) {
+    const std::string arg = argv[iArg];
+    std::string value;
+    if (parseOption(arg, "benchmark_filter", value)) {
+      filter = value;
+    } else if (parseOption(arg, "benchmark_min_time", value)) {
+      min_time = std::atof(value.c_str());
+    } else if (parseOption(arg, "benchmark_repetitions", value)) {
+      num_repetition = std::max(1, std::atoi(value.c_str()));
+    } else if (parseOption(arg, "benchmark_out", value)) {
+      out_file = value;
+    } else if (parseOption(arg, "benchmark_out_format", value)) {
+      // Only JSON is written to --benchmark_out
+      if (value != "json") {
+        printf("Unsupported --benchmark_out_format=%s\n", value.c_str());
+        return 1;
+      }
+    } else if (parseOption(arg, "benchmark_format", value)) {
+      if (value != "console" && value != "json") {
+        printf("Unsupported --benchmark_format=%s\n", value.c_str());
+        return 1;
+      }
+      format = value;
+    } else if (arg == "--benchmark_list_tests" ||
+               arg == "--benchmark_list_tests=true") {
+      list_tests = true;
+    } else if (parseOption(arg, "instance_dir", value)) {
+      instance_dir = value;
+    } else {
+      printUsage(argv[0]);
+      return arg == "--help" ? 0 : 1;
+    }
+  }
+
+  registerBenchmarks();
+  std::vector<const Benchmark*> selected;
+  try {
+    const std::regex filter_regex(filter);
+    for (const Benchmark& benchmark : benchmarks())
+      if (std::regex_search(benchmark.name, filter_regex))
+        selected.push_back(&benchmark);
+  } catch (const std::regex_error&) {
+    printf("Invalid --benchmark_filter=%s\n", filter.c_str());
+    return 1;
+  }
+  if (list_tests) {
+    for (const Benchmark* benchmark : selected)
+      printf("%s\n", benchmark->name.c_str());
+    return 0;
+  }
+
+  const bool console = format == "console";
+  HighsInt name_width = 9;
+  for (const Benchmark* benchmark : selected)
+    name_width = std::max(name_width, (HighsInt)benchmark->name.size() +
+                                          (num_repetition > 1 ? 7 : 0));
+  if (console) {
+    printf("%-*s %14s %14s %11s\n", (int)name_width, "Benchmark", "Time",
+           "CPU", "Iterations");
+    printf("%s\n", std::string(name_width + 42, '-').c_str());
+  }
+  std::vector<BenchRun> all_runs;
+  for (size_t iBenchmark = 0; iBenchmark < selected.size(); iBenchmark++) {
+    std::vector<BenchRun> runs;
+    for (HighsInt iRepetition = 0; iRepetition < num_repetition;
+         iRepetition++) {
+      BenchRun run = runBenchmark(*selected[iBenchmark], min_time);
+      run.family_index = iBenchmark;
+      run.repetition_index = iRepetition;
+      if (console) reportRun(run, name_width);
+      runs.push_back(run);
+      if (!run.error_message.empty()) break;
+    }
+    all_runs.insert(all_runs.end(), runs.begin(), runs.end());
+    if (num_repetition > 1 && runs.back().error_message.empty()) {
+      for (const BenchRun& run : aggregateRuns(runs)) {
+        if (console) reportRun(run, name_width);
+        all_runs.push_back(run);
+      }
+    }
+  }
+
+  bool error_occurred = false;
+  for (const BenchRun& run : all_runs)
+    if (!run.error_message.empty()) error_occurred = true;
+  if (!console) writeJson(std::cout, all_runs, num_repetition, argv[0]);
+  if (!out_file.empty()) {
+    std::ofstream file(out_file);
+    writeJson(file, all_runs, num_repetition, argv[0]);
+    if (!file) {
+      printf("Unable to write %s\n", out_file.c_str());
+      return 1;
+    }
+  }
+  return error_occurred ? 1 : 0;
+}
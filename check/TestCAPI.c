@@ -1441,6 +1441,78 @@ void test_setSolution() {
   Highs_destroy(highs);
 }
 */
+void test_lpBuilder() {
+  // min x + 2y s.t. x + y >= 1, with the matrix entries given as
+  // triplets
+  void* builder = Highs_lpBuilderCreate();
+  double inf = 1e30;
+  double cost[2] = {1.0, 2.0};
+  double col_lower[2] = {0.0, 0.0};
+  double col_upper[2] = {inf, inf};
+  double row_lower[1] = {1.0};
+  double row_upper[1] = {inf};
+  HighsInt row[2] = {0, 0};
+  HighsInt col[2] = {0, 1};
+  double value[2] = {1.0, 1.0};
+  HighsInt return_status;
+  return_status = Highs_lpBuilderReserve(builder, 2, 1, 0);
+  assertIntValuesEqual("Return of lpBuilderReserve", return_status, kHighsStatusOk);
+  return_status = Highs_lpBuilderAddCols(builder, 2, cost, col_lower, col_upper,
+                                         0, NULL, NULL, NULL);
+  assertIntValuesEqual("Return of lpBuilderAddCols", return_status, kHighsStatusOk);
+  return_status = Highs_lpBuilderAddRows(builder, 1, row_lower, row_upper, 0,
+                                         NULL, NULL, NULL);
+  assertIntValuesEqual("Return of lpBuilderAddRows", return_status, kHighsStatusOk);
+  return_status = Highs_lpBuilderAddEntries(builder, 2, row, col, value);
+  assertIntValuesEqual("Return of lpBuilderAddEntries", return_status, kHighsStatusOk);
+  return_status = Highs_lpBuilderSetObjective(builder, kHighsObjSenseMinimize, 0.0);
+  assertIntValuesEqual("Return of lpBuilderSetObjective", return_status, kHighsStatusOk);
+
+  void* highs = Highs_create();
+  if (!dev_run) Highs_setBoolOptionValue(highs, "output_flag", 0);
+  return_status = Highs_passLpBuilder(highs, builder);
+  assertIntValuesEqual("Return of passLpBuilder", return_status, kHighsStatusOk);
+  assertIntValuesEqual("Num col", Highs_getNumCol(highs), 2);
+  assertIntValuesEqual("Num row", Highs_getNumRow(highs), 1);
+  assertIntValuesEqual("Num nz", Highs_getNumNz(highs), 2);
+  Highs_run(highs);
+  assertIntValuesEqual("Status", Highs_getModelStatus(highs), kHighsModelStatusOptimal);
+  assertDoubleValuesEqual("Objective", Highs_getObjectiveValue(highs), 1.0);
+
+  // Write the same LP directly into arrays allocated by the builder
+  double* a_col_cost;
+  double* a_col_lower;
+  double* a_col_upper;
+  double* a_row_lower;
+  double* a_row_upper;
+  HighsInt* a_start;
+  HighsInt* a_index;
+  double* a_value;
+  return_status = Highs_lpBuilderAllocate(
+      builder, 2, 1, 2, &a_col_cost, &a_col_lower, &a_col_upper, &a_row_lower,
+      &a_row_upper, &a_start, &a_index, &a_value);
+  assertIntValuesEqual("Return of lpBuilderAllocate", return_status, kHighsStatusOk);
+  for (HighsInt iCol = 0; iCol < 2; iCol++) {
+    a_col_cost[iCol] = cost[iCol];
+    a_col_lower[iCol] = col_lower[iCol];
+    a_col_upper[iCol] = col_upper[iCol];
+    a_start[iCol] = iCol;
+    a_index[iCol] = 0;
+    a_value[iCol] = 1.0;
+  }
+  a_row_lower[0] = row_lower[0];
+  a_row_upper[0] = row_upper[0];
+  return_status = Highs_passLpBuilder(highs, builder);
+  assertIntValuesEqual("Return of passLpBuilder", return_status, kHighsStatusOk);
+  assertIntValuesEqual("Num nz", Highs_getNumNz(highs), 2);
+  Highs_run(highs);
+  assertIntValuesEqual("Status", Highs_getModelStatus(highs), kHighsModelStatusOptimal);
+  assertDoubleValuesEqual("Objective", Highs_getObjectiveValue(highs), 1.0);
+
+  Highs_destroy(highs);
+  Highs_lpBuilderDestroy(builder);
+}
+
 int main() {
   test_callback();
   version_api();
@@ -1457,6 +1529,7 @@ int main() {
   test_getColsByRange();
   test_passHessian();
   test_ranging();
+  test_lpBuilder();
   //  test_setSolution();
   return 0;
 }
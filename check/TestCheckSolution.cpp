@@ -1,4 +1,6 @@
 #include <cstdio>
+#include <fstream>
+#include <sstream>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
@@ -406,3 +408,61 @@ void runSetLpSolution(const std::string model) {
         (int)simplex_iteration_count1);
   REQUIRE(simplex_iteration_count1 < simplex_iteration_count0);
 }
+
+static std::string readFileContents(const std::string& filename) {
+  std::ifstream file(filename);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+TEST_CASE("write-solution-async", "[highs_check_solution]") {
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  const std::string solution_file = "WriteSolution.sol";
+  const std::string async_solution_file = "WriteSolutionAsync.sol";
+  const std::string basis_file = "WriteBasis.bas";
+  const std::string async_basis_file = "WriteBasisAsync.bas";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("ranging", kHighsOnString);
+  highs.readModel(model_file);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.writeSolution(solution_file) == HighsStatus::kOk);
+  REQUIRE(highs.writeBasis(basis_file) == HighsStatus::kOk);
+  std::future<HighsStatus> solution_written =
+      highs.writeSolutionAsync(async_solution_file);
+  std::future<HighsStatus> basis_written =
+      highs.writeBasisAsync(async_basis_file);
+  // The files are written from snapshots, so the model can be
+  // cleared straight away
+  REQUIRE(highs.clearModel() == HighsStatus::kOk);
+  REQUIRE(solution_written.get() == HighsStatus::kOk);
+  REQUIRE(basis_written.get() == HighsStatus::kOk);
+  REQUIRE(readFileContents(async_solution_file) ==
+          readFileContents(solution_file));
+  REQUIRE(readFileContents(async_basis_file) == readFileContents(basis_file));
+
+  // Errors are returned through the future
+  REQUIRE(highs.writeSolutionAsync("/nonexistent/dir/x.sol").get() ==
+          HighsStatus::kError);
+  // Writing to stdout on another thread isn't supported
+  REQUIRE(highs.writeSolutionAsync("").get() == HighsStatus::kError);
+  REQUIRE(highs.writeBasisAsync("").get() == HighsStatus::kError);
+
+  // Ranging can't be determined for a MIP, so the solution is written
+  // without it, and an error is returned, as by writeSolution
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/egout.mps");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.writeSolution(solution_file) == HighsStatus::kError);
+  REQUIRE(highs.writeSolutionAsync(async_solution_file).get() ==
+          HighsStatus::kError);
+  REQUIRE(!readFileContents(solution_file).empty());
+  REQUIRE(readFileContents(async_solution_file) ==
+          readFileContents(solution_file));
+
+  std::remove(solution_file.c_str());
+  std::remove(async_solution_file.c_str());
+  std::remove(basis_file.c_str());
+  std::remove(async_basis_file.c_str());
+}
@@ -1,4 +1,7 @@
 #include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
@@ -7,8 +10,13 @@
 #include "io/HMPSIO.h"
 #include "io/HMpsFF.h"
 #include "io/HighsIO.h"
+#include "io/HighsInputFile.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsLpUtils.h"
+#include "util/stringutil.h"
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+#endif
 
 const bool dev_run = false;
 
@@ -312,3 +320,200 @@ TEST_CASE("filereader-fixed-integer", "[highs_filereader]") {
   objective_value = highs.getInfo().objective_function_value;
   REQUIRE(objective_value == optimal_objective_value);
 }
+
+TEST_CASE("filereader-hbin", "[highs_filereader]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const std::string filename_hbin = "hbin-test.hbin";
+  for (std::string model : {"egout", "qjh", "adlittle"}) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    HighsModel model_mps = highs.getModel();
+    REQUIRE(highs.writeModel(filename_hbin) == HighsStatus::kOk);
+    REQUIRE(highs.readModel(filename_hbin) == HighsStatus::kOk);
+    // The model name is taken from the file name
+    model_mps.lp_.model_name_ = highs.getLp().model_name_;
+    REQUIRE(highs.getModel() == model_mps);
+  }
+  std::remove(filename_hbin.c_str());
+
+  // A text file with the .hbin extension is rejected
+  const std::string filename_garbage = "garbage.hbin";
+  FILE* file = fopen(filename_garbage.c_str(), "w");
+  fprintf(file, "NAME garbage\n");
+  fclose(file);
+  REQUIRE(highs.readModel(filename_garbage) == HighsStatus::kError);
+  std::remove(filename_garbage.c_str());
+
+  // A file whose matrix starts decrease, or whose matrix or Hessian
+  // has an index out of range, is rejected, even if it's trusted
+  highs.setOptionValue("trust_hbin_model_file", true);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/qjh.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  const HighsLp lp = highs.getLp();
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt num_nz = lp.a_matrix_.numNz();
+  // The arrays follow an 80-byte header
+  const long start_offset =
+      80 + sizeof(double) * (3 * num_col + 2 * num_row);
+  const long index_offset = start_offset + sizeof(HighsInt) * (num_col + 1);
+  const long integrality_size =
+      lp.integrality_.size() == size_t(num_col) ? num_col : 0;
+  const long hessian_start_offset =
+      index_offset + (sizeof(HighsInt) + sizeof(double)) * num_nz +
+      integrality_size;
+  const long hessian_index_offset =
+      hessian_start_offset + sizeof(HighsInt) * (num_col + 1);
+  auto corruptHbin = [&](const long offset, const HighsInt value) {
+    REQUIRE(highs.writeModel(filename_hbin) == HighsStatus::kOk);
+    file = fopen(filename_hbin.c_str(), "r+b");
+    REQUIRE(file != nullptr);
+    REQUIRE(fseek(file, offset, SEEK_SET) == 0);
+    REQUIRE(fwrite(&value, sizeof(HighsInt), 1, file) == 1);
+    fclose(file);
+    Highs highs_corrupt;
+    highs_corrupt.setOptionValue("output_flag", dev_run);
+    highs_corrupt.setOptionValue("trust_hbin_model_file", true);
+    return highs_corrupt.readModel(filename_hbin);
+  };
+  REQUIRE(corruptHbin(start_offset + sizeof(HighsInt), num_nz) ==
+          HighsStatus::kError);
+  REQUIRE(corruptHbin(index_offset, num_row) == HighsStatus::kError);
+  REQUIRE(corruptHbin(index_offset, -1) == HighsStatus::kError);
+  REQUIRE(corruptHbin(hessian_index_offset, num_col) == HighsStatus::kError);
+  // Rewriting a value with itself leaves a valid file
+  REQUIRE(corruptHbin(index_offset, lp.a_matrix_.index_[0]) ==
+          HighsStatus::kOk);
+  std::remove(filename_hbin.c_str());
+}
+
+#ifdef ZLIB_FOUND
+static void gzipFile(const std::string& source, const std::string& target) {
+  std::ifstream in(source, std::ios::in | std::ios::binary);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  const std::string data = contents.str();
+  gzFile out = gzopen(target.c_str(), "wb");
+  REQUIRE(out != nullptr);
+  REQUIRE(gzwrite(out, data.data(), data.size()) == (int)data.size());
+  gzclose(out);
+}
+
+TEST_CASE("filereader-compressed", "[highs_filereader]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  HighsLp lp;
+  const std::string filename_lp = "compressed-test.lp";
+  REQUIRE(highs.writeModel(filename_lp) == HighsStatus::kOk);
+  REQUIRE(highs.readModel(filename_lp) == HighsStatus::kOk);
+  HighsLp lp_from_lp = highs.getLp();
+
+  const std::string filename_mps_gz = "compressed-test.mps.gz";
+  const std::string filename_lp_gz = "compressed-test.lp.gz";
+  gzipFile(model_file, filename_mps_gz);
+  gzipFile(filename_lp, filename_lp_gz);
+  REQUIRE(HighsInputFile::detectCompression(filename_mps_gz) ==
+          HighsInputFileCompression::kGzip);
+  REQUIRE(HighsInputFile::detectCompression(filename_lp) ==
+          HighsInputFileCompression::kNone);
+
+  for (bool free_format : {true, false}) {
+    highs.setOptionValue("mps_parser_type_free", free_format);
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    lp = highs.getLp();
+    REQUIRE(highs.readModel(filename_mps_gz) == HighsStatus::kOk);
+    lp.model_name_ = highs.getLp().model_name_;
+    REQUIRE(highs.getLp() == lp);
+  }
+  REQUIRE(highs.readModel(filename_lp_gz) == HighsStatus::kOk);
+  lp_from_lp.model_name_ = highs.getLp().model_name_;
+  REQUIRE(highs.getLp() == lp_from_lp);
+
+  // A truncated or corrupt compressed file is a read error, rather
+  // than the end of the file
+  std::ifstream in(filename_lp_gz, std::ios::in | std::ios::binary);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  in.close();
+  const std::string data = contents.str();
+  const std::string filename_bad_gz = "compressed-test-bad.lp.gz";
+  auto writeBadGz = [&](const std::string& bad_data) {
+    std::ofstream out(filename_bad_gz, std::ios::out | std::ios::binary);
+    out << bad_data;
+  };
+  writeBadGz(data.substr(0, data.size() / 2));
+  REQUIRE(highs.readModel(filename_bad_gz) == HighsStatus::kError);
+  std::string corrupt_data = data;
+  for (size_t iByte = data.size() / 4; iByte < data.size() / 2; iByte++)
+    corrupt_data[iByte] = ~corrupt_data[iByte];
+  writeBadGz(corrupt_data);
+  REQUIRE(highs.readModel(filename_bad_gz) == HighsStatus::kError);
+  std::remove(filename_bad_gz.c_str());
+
+  std::remove(filename_lp.c_str());
+  std::remove(filename_mps_gz.c_str());
+  std::remove(filename_lp_gz.c_str());
+}
+#endif
+
+TEST_CASE("filereader-write-mip", "[highs_filereader]") {
+  // Writes a MIP, whose integer columns are interleaved with
+  // continuous columns, in MPS and LP format, and checks that reading
+  // each file gives the same integrality and optimal objective
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  // Some row names in egout are numbers, which the LP file reader
+  // can't parse, so the model is written with names of its own
+  HighsLp lp = highs.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    lp.col_names_[iCol] = "c" + std::to_string(iCol);
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+    lp.row_names_[iRow] = "r" + std::to_string(iRow);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_value = highs.getInfo().objective_function_value;
+  for (std::string filename : {"write-mip.mps", "write-mip.lp"}) {
+    REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    if (filename == "write-mip.mps") {
+      REQUIRE(highs.getLp().integrality_ == lp.integrality_);
+      REQUIRE(highs.getLp().a_matrix_.numNz() == lp.a_matrix_.numNz());
+    }
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      objective_value) < 1e-6);
+    std::remove(filename.c_str());
+    // Restore the original model for the next write
+    REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  }
+}
+
+TEST_CASE("filereader-str-to-double", "[highs_filereader]") {
+  // Values are converted exactly as by atof, whether or not they can
+  // be converted without strtod
+  const std::vector<std::string> value_string = {
+      "0",         "-0",        "1",         "-2.5",
+      "+3.",       ".125",      "1e22",      "1e23",
+      "-1.5E-7",   "0.1",       "1.0e-22",   "1e-23",
+      "1.5abc",    "1d3",       "inf",       "-Infinity",
+      "0x1p3",     "1e",        "  4",       "",
+      ".",         "1e-400",    "1e400",     "9007199254740993",
+      "123456789012345678",     "000000000000000000000012.75"};
+  for (const std::string& value : value_string) {
+    const double expected = atof(value.c_str());
+    const double computed = strToDouble(value);
+    if (dev_run)
+      printf("\"%s\": atof = %.17g; strToDouble = %.17g\n", value.c_str(),
+             expected, computed);
+    REQUIRE(std::memcmp(&expected, &computed, sizeof(double)) == 0);
+  }
+}
@@ -6,6 +6,7 @@
 
 #include <iostream>
 
+#include "Highs.h"
 #include "catch.hpp"
 #include "matrix_multiplication.hpp"
 #include "parallel/HighsParallel.h"
@@ -239,6 +240,187 @@ TEST_CASE("FibonacciTasksHighs", "[parallel]") {
   REQUIRE(result == 267914296);
 }
 
+TEST_CASE("TaskExecutorInstances", "[parallel]") {
+  // Executors that belong to no thread, each with its own number of
+  // workers
+  auto executor2 = HighsTaskExecutor::createExecutor(2);
+  auto executor3 = HighsTaskExecutor::createExecutor(3);
+  REQUIRE(HighsTaskExecutor::getNumWorkerThreads(*executor2) == 2);
+  REQUIRE(HighsTaskExecutor::getNumWorkerThreads(*executor3) == 3);
+
+  // Catch assertions can't be made off the main thread, so the
+  // results are checked after the threads are joined
+  auto runOnExecutor =
+      [](std::shared_ptr<HighsTaskExecutor::ExecutorHandle> executor,
+         int& num_workers, int64_t& result) {
+        if (HighsTaskExecutor::isInitialized()) return;
+        {
+          HighsTaskExecutor::ScopedBinding binding(executor);
+          if (!HighsTaskExecutor::isInitialized()) return;
+          num_workers = parallel::num_threads();
+          result = fib(30);
+        }
+        if (HighsTaskExecutor::isInitialized()) num_workers = -1;
+      };
+  int num_workers2 = 0;
+  int num_workers3 = 0;
+  int64_t result2 = 0;
+  int64_t result3 = 0;
+  std::thread thread2(runOnExecutor, executor2, std::ref(num_workers2),
+                      std::ref(result2));
+  std::thread thread3(runOnExecutor, executor3, std::ref(num_workers3),
+                      std::ref(result3));
+  thread2.join();
+  thread3.join();
+  REQUIRE(num_workers2 == 2);
+  REQUIRE(num_workers3 == 3);
+  REQUIRE(result2 == 1346269);
+  REQUIRE(result3 == 1346269);
+
+  // Highs instances solving concurrently on one shared executor, and
+  // on one of their own
+  auto shared_executor = Highs::createTaskExecutor(2);
+  REQUIRE(shared_executor != nullptr);
+  REQUIRE(Highs::createTaskExecutor(-1) == nullptr);
+  const std::vector<std::string> models = {"egout", "flugpl", "egout"};
+  const std::vector<double> optimal_objective = {568.1007, 1201500, 568.1007};
+  std::vector<double> objective(models.size(), 0);
+  auto solve = [&](const size_t k) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    if (k < 2) {
+      highs.setTaskExecutor(shared_executor);
+    } else {
+      highs.setTaskExecutor(Highs::createTaskExecutor(3));
+    }
+    highs.readModel(std::string(HIGHS_DIR) + "/check/instances/" + models[k] +
+                    ".mps");
+    highs.run();
+    objective[k] = highs.getInfo().objective_function_value;
+  };
+  std::vector<std::thread> threads;
+  for (size_t k = 0; k < models.size(); k++) threads.emplace_back(solve, k);
+  for (auto& thread : threads) thread.join();
+  for (size_t k = 0; k < models.size(); k++)
+    REQUIRE(std::fabs(objective[k] - optimal_objective[k]) <
+            1e-6 * std::max(1.0, std::fabs(optimal_objective[k])));
+}
+
+TEST_CASE("TaskExecutorNestedBinding", "[parallel]") {
+  // Tasks that bind to the executor that they run on, as a nested
+  // Highs::run does, carry on as the worker that runs them, rather
+  // than waiting for the thread bound to the executor
+  auto executor = HighsTaskExecutor::createExecutor(3);
+  HighsTaskExecutor::ScopedBinding binding(executor);
+  const HighsInt num_task = 32;
+  std::vector<int64_t> result(num_task, 0);
+  std::vector<int> num_workers(num_task, 0);
+  parallel::for_each(0, num_task, [&](HighsInt from, HighsInt to) {
+    for (HighsInt k = from; k < to; k++) {
+      HighsTaskExecutor::ScopedBinding nested_binding(executor);
+      num_workers[k] = parallel::num_threads();
+      result[k] = fib(25);
+    }
+  });
+  for (HighsInt k = 0; k < num_task; k++) {
+    REQUIRE(num_workers[k] == 3);
+    REQUIRE(result[k] == 121393);
+  }
+}
+
+TEST_CASE("TaskExecutorPinned", "[parallel]") {
+  const int num_workers = 4;
+  {
+    HighsWorkerPlacement placement;
+    placement.setup(num_workers);
+    for (int iWorker = 0; !placement.empty() && iWorker < num_workers;
+         iWorker++) {
+      REQUIRE(placement.groupBegin(iWorker) <= iWorker);
+      REQUIRE(iWorker < placement.groupEnd(iWorker));
+      REQUIRE(placement.groupEnd(iWorker) <= num_workers);
+    }
+  }
+
+  // Placements that exist at the same time don't share CPUs, and the
+  // CPUs of a placement can be claimed again once it is destroyed
+  {
+    HighsWorkerPlacement placement1;
+    placement1.setup(2);
+    std::vector<int> cpus1;
+    for (int iWorker = 0; !placement1.empty() && iWorker < 2; iWorker++)
+      cpus1.push_back(placement1.cpu(iWorker));
+    {
+      HighsWorkerPlacement placement2;
+      placement2.setup(2);
+      for (int iWorker = 0; !placement2.empty() && iWorker < 2; iWorker++)
+        for (const int cpu : cpus1) REQUIRE(placement2.cpu(iWorker) != cpu);
+    }
+    placement1.setup(2);
+    if (!cpus1.empty()) REQUIRE(!placement1.empty());
+  }
+
+  // Pinned workers create their own deques, and all must be usable
+  // whether or not the topology could be determined
+  HighsSchedulerConfig config;
+  config.pinThreads = true;
+  config.localityAwareStealing = true;
+  auto executor = HighsTaskExecutor::createExecutor(num_workers, config);
+  HighsTaskExecutor::ScopedBinding binding(executor);
+  REQUIRE(parallel::num_threads() == num_workers);
+  REQUIRE(fib(30) == 1346269);
+}
+
+TEST_CASE("TaskExecutorStats", "[parallel]") {
+  auto executor = HighsTaskExecutor::createExecutor(3);
+  HighsTaskExecutor::ScopedBinding binding(executor);
+  HighsTaskExecutor::resetWorkerStats();
+  REQUIRE(fib(30) == 1346269);
+  std::vector<HighsSplitDeque::WorkerStats> stats =
+      HighsTaskExecutor::getWorkerStats();
+  REQUIRE(stats.size() == 3);
+  // fib(30) spawns one task for each call with n > 20, each of which
+  // is run either by worker 0 or by a worker that stole it
+  uint64_t num_tasks = 0;
+  for (const HighsSplitDeque::WorkerStats& worker : stats) {
+    num_tasks += worker.numTasksRun + worker.numTasksStolen;
+    REQUIRE(worker.numOverflowTasks == 0);
+    REQUIRE(worker.stealLoopTime >= 0);
+    REQUIRE(worker.parkedTime >= 0);
+  }
+  REQUIRE(num_tasks == 143);
+  HighsTaskExecutor::resetWorkerStats();
+  REQUIRE(HighsTaskExecutor::getWorkerStats()[0].numTasksRun == 0);
+}
+
+TEST_CASE("TaskExecutorIdlePolicy", "[parallel]") {
+  for (HighsIdlePolicy policy :
+       {HighsIdlePolicy::kSpin, HighsIdlePolicy::kPark,
+        HighsIdlePolicy::kAdaptive}) {
+    HighsSchedulerConfig config;
+    config.idlePolicy = policy;
+    config.maxSpinMicroSecs = 1000;
+    auto executor = HighsTaskExecutor::createExecutor(3, config);
+    HighsTaskExecutor::ScopedBinding binding(executor);
+    for (int k = 0; k < 10; k++) REQUIRE(fib(25) == 121393);
+    for (const HighsSplitDeque::WorkerStats& worker :
+         HighsTaskExecutor::getWorkerStats()) {
+      REQUIRE(worker.wakeupLatency >= 0);
+      switch (policy) {
+        case HighsIdlePolicy::kSpin:
+          REQUIRE(worker.spinMicroSecs == 1000);
+          break;
+        case HighsIdlePolicy::kPark:
+          REQUIRE(worker.spinMicroSecs == 0);
+          break;
+        case HighsIdlePolicy::kAdaptive:
+          REQUIRE(worker.spinMicroSecs >=
+                  HighsSchedulerConstants::kMinAdaptiveSpinMicroSecs);
+          REQUIRE(worker.spinMicroSecs <= 1000);
+      }
+    }
+  }
+}
+
 #if 0
 TEST_CASE("MatrixMultOmp", "[parallel]") {
   if (dev_run)
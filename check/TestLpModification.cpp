@@ -1874,3 +1874,121 @@ TEST_CASE("mod-duplicate-indices", "[highs_data]") {
   REQUIRE(objective0 < objective1);
   REQUIRE(objective0 == -7.75);
 }
+
+TEST_CASE("LP-builder", "[highs_data]") {
+  const double cost[3] = {1, 2, 3};
+  const double col_lower[3] = {0, 0, 0};
+  const double col_upper[3] = {inf, inf, inf};
+  const double row_lower[2] = {1, 1};
+  const double row_upper[2] = {inf, inf};
+  const HighsInt a_start[3] = {0, 1, 3};
+  const HighsInt a_index[4] = {0, 0, 1, 1};
+  const double a_value[4] = {1, 1, 1, 1};
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.passModel(3, 2, 4, (HighsInt)MatrixFormat::kColwise,
+                          (HighsInt)ObjSense::kMinimize, 0, cost, col_lower,
+                          col_upper, row_lower, row_upper, a_start, a_index,
+                          a_value) == HighsStatus::kOk);
+  const HighsLp reference = highs.getLp();
+
+  // Columns with their entries, before the rows
+  HighsLpBuilder builder;
+  builder.reserve(3, 2, 4);
+  REQUIRE(builder.addCols(3, cost, col_lower, col_upper, 4, a_start, a_index,
+                          a_value) == HighsStatus::kOk);
+  REQUIRE(builder.addRows(2, row_lower, row_upper) == HighsStatus::kOk);
+  REQUIRE(builder.getNumNz() == 4);
+  REQUIRE(highs.passModel(builder) == HighsStatus::kOk);
+  REQUIRE(highs.getLp() == reference);
+  REQUIRE(builder.getNumCol() == 0);
+
+  // Rows with their entries, before the columns
+  const HighsInt ar_start[2] = {0, 2};
+  const HighsInt ar_index[4] = {0, 1, 1, 2};
+  REQUIRE(builder.addRows(2, row_lower, row_upper, 4, ar_start, ar_index,
+                          a_value) == HighsStatus::kOk);
+  for (HighsInt iCol = 0; iCol < 3; iCol++)
+    REQUIRE(builder.addCol(cost[iCol], col_lower[iCol], col_upper[iCol]) ==
+            HighsStatus::kOk);
+  REQUIRE(highs.passModel(builder) == HighsStatus::kOk);
+  REQUIRE(highs.getLp() == reference);
+
+  // Entries split between columns and triplets
+  REQUIRE(builder.addCol(cost[0], col_lower[0], col_upper[0], 1, a_index,
+                         a_value) == HighsStatus::kOk);
+  REQUIRE(builder.addCols(2, &cost[1], &col_lower[1], &col_upper[1]) ==
+          HighsStatus::kOk);
+  REQUIRE(builder.addRows(2, row_lower, row_upper) == HighsStatus::kOk);
+  const HighsInt t_row[3] = {0, 1, 1};
+  const HighsInt t_col[3] = {1, 1, 2};
+  REQUIRE(builder.addEntries(3, t_row, t_col, a_value) == HighsStatus::kOk);
+  REQUIRE(builder.setIntegrality(1, HighsVarType::kInteger) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.passModel(builder) == HighsStatus::kOk);
+  REQUIRE(highs.getLp().isMip());
+  REQUIRE(highs.getLp().a_matrix_ == reference.a_matrix_);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - 2) <
+          double_equal_tolerance);
+
+  // Starts must begin at zero and be nondecreasing
+  const HighsInt bad_start[3] = {0, 2, 1};
+  REQUIRE(builder.addCols(3, cost, col_lower, col_upper, 4, bad_start, a_index,
+                          a_value) == HighsStatus::kError);
+  REQUIRE(builder.getNumCol() == 0);
+
+  // Entries must refer to rows and columns that have been added
+  REQUIRE(builder.addCol(cost[0], col_lower[0], col_upper[0]) ==
+          HighsStatus::kOk);
+  const HighsInt bad_row = 5;
+  const HighsInt col = 0;
+  REQUIRE(builder.addEntries(1, &bad_row, &col, a_value) == HighsStatus::kOk);
+  REQUIRE(highs.passModel(builder) == HighsStatus::kError);
+}
+
+TEST_CASE("LP-pass-model-move", "[highs_data]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/avgas.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  HighsLp lp = highs.getLp();
+  const HighsLp copy_lp = lp;
+
+  // Passing a copy leaves the LP unchanged
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(lp == copy_lp);
+
+  // Moving the LP gives its arrays to Highs
+  const double* cost_data = lp.col_cost_.data();
+  const HighsInt* index_data = lp.a_matrix_.index_.data();
+  const double* value_data = lp.a_matrix_.value_.data();
+  REQUIRE(highs.passModel(std::move(lp)) == HighsStatus::kOk);
+  REQUIRE(highs.getLp().col_cost_.data() == cost_data);
+  REQUIRE(highs.getLp().a_matrix_.index_.data() == index_data);
+  REQUIRE(highs.getLp().a_matrix_.value_.data() == value_data);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  // Data written into an LP builder's arrays are also not copied
+  HighsLpBuilder builder;
+  HighsLp& builder_lp = builder.allocate(copy_lp.num_col_, copy_lp.num_row_,
+                                        copy_lp.a_matrix_.numNz());
+  builder_lp.col_cost_ = copy_lp.col_cost_;
+  builder_lp.col_lower_ = copy_lp.col_lower_;
+  builder_lp.col_upper_ = copy_lp.col_upper_;
+  builder_lp.row_lower_ = copy_lp.row_lower_;
+  builder_lp.row_upper_ = copy_lp.row_upper_;
+  std::copy(copy_lp.a_matrix_.start_.begin(), copy_lp.a_matrix_.start_.end(),
+            builder_lp.a_matrix_.start_.begin());
+  std::copy(copy_lp.a_matrix_.index_.begin(), copy_lp.a_matrix_.index_.end(),
+            builder_lp.a_matrix_.index_.begin());
+  std::copy(copy_lp.a_matrix_.value_.begin(), copy_lp.a_matrix_.value_.end(),
+            builder_lp.a_matrix_.value_.begin());
+  index_data = builder_lp.a_matrix_.index_.data();
+  REQUIRE(highs.passModel(builder) == HighsStatus::kOk);
+  REQUIRE(highs.getLp().a_matrix_.index_.data() == index_data);
+  REQUIRE(highs.getLp().a_matrix_ == copy_lp.a_matrix_);
+}
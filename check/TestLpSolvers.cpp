@@ -1,6 +1,10 @@
+#include <fstream>
+#include <thread>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "util/HighsTrace.h"
 
 const bool dev_run = false;
 
@@ -434,3 +438,202 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-10);
 }
+
+TEST_CASE("LP-solve-batch", "[highs_lp_solver]") {
+  // A batch of perturbed LPs and a MIP, whose solutions must match
+  // those of solving each model in turn
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/avgas.mps");
+  const HighsModel avgas = highs.getModel();
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/flugpl.mps");
+  const HighsModel flugpl = highs.getModel();
+  std::vector<HighsModel> models;
+  const HighsInt num_lp = 20;
+  for (HighsInt k = 0; k < num_lp; k++) {
+    HighsModel model = avgas;
+    model.lp_.col_cost_[k % model.lp_.num_col_] *= 1 + 0.1 * k;
+    models.push_back(model);
+  }
+  models.push_back(flugpl);
+  std::vector<double> objective_value;
+  for (const HighsModel& model : models) {
+    highs.passModel(model);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    objective_value.push_back(highs.getInfo().objective_function_value);
+  }
+  highs.clearModel();
+
+  std::vector<HighsBatchResult> results;
+  for (HighsInt pass = 0; pass < 2; pass++) {
+    // Solve on the scheduler of this thread, and then on an executor
+    // attached to the instance
+    if (pass == 1) highs.setTaskExecutor(Highs::createTaskExecutor(3));
+    REQUIRE(highs.solveBatch(models, results) == HighsStatus::kOk);
+    REQUIRE(results.size() == models.size());
+    for (size_t k = 0; k < models.size(); k++) {
+      REQUIRE(results[k].run_status == HighsStatus::kOk);
+      REQUIRE(results[k].model_status == HighsModelStatus::kOptimal);
+      REQUIRE(std::fabs(results[k].info.objective_function_value -
+                        objective_value[k]) <
+              1e-6 * std::max(1.0, std::fabs(objective_value[k])));
+      REQUIRE(results[k].solution.value_valid);
+      REQUIRE((HighsInt)results[k].solution.col_value.size() ==
+              models[k].lp_.num_col_);
+    }
+    // The incumbent model is unchanged
+    REQUIRE(highs.getNumCol() == 0);
+  }
+  REQUIRE(highs.solveBatch({}, results) == HighsStatus::kOk);
+  REQUIRE(results.empty());
+
+  // A model taken from an instance that has been run can be solved in
+  // a batch
+  highs.passModel(avgas);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const std::vector<HighsModel> solved_models(2, highs.getModel());
+  REQUIRE(highs.solveBatch(solved_models, results) == HighsStatus::kOk);
+  for (const HighsBatchResult& result : results) {
+    REQUIRE(result.model_status == HighsModelStatus::kOptimal);
+    // The first model of the batch is avgas unperturbed
+    REQUIRE(std::fabs(result.info.objective_function_value -
+                      objective_value[0]) < 1e-6);
+  }
+}
+
+TEST_CASE("LP-simplex-workspace", "[highs_lp_solver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/avgas.mps");
+  const HighsModel avgas = highs.getModel();
+  std::shared_ptr<HighsSimplexWorkspace> workspace =
+      highs.getSimplexWorkspace();
+  REQUIRE(workspace);
+  REQUIRE(workspace->getNumPooled() == 0);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_value = highs.getInfo().objective_function_value;
+  // The vectors of the simplex solver are returned to the workspace
+  const HighsInt num_pooled = workspace->getNumPooled();
+  REQUIRE(num_pooled > 0);
+
+  // Repeated solves, including those by another instance sharing
+  // the workspace, use the pooled vectors rather than new ones
+  Highs highs2;
+  highs2.setOptionValue("output_flag", dev_run);
+  highs2.setSimplexWorkspace(workspace);
+  REQUIRE(highs2.getSimplexWorkspace() == workspace);
+  for (HighsInt k = 0; k < 3; k++) {
+    Highs& solver = k == 1 ? highs2 : highs;
+    solver.passModel(avgas);
+    REQUIRE(solver.run() == HighsStatus::kOk);
+    REQUIRE(std::fabs(solver.getInfo().objective_function_value -
+                      objective_value) < 1e-6);
+    REQUIRE(workspace->getNumPooled() == num_pooled);
+  }
+
+  // Resetting the workspace gives the instance one of its own
+  highs2.setSimplexWorkspace(nullptr);
+  REQUIRE(highs2.getSimplexWorkspace());
+  REQUIRE(highs2.getSimplexWorkspace() != workspace);
+}
+
+TEST_CASE("LP-trace-file", "[highs_lp_solver]") {
+  const std::string trace_file = "LP-trace-file.json";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/avgas.mps");
+  highs.setOptionValue("trace_file", trace_file);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt num_event = HighsTrace::getNumEvents();
+  REQUIRE(num_event > 0);
+
+  std::ifstream file(trace_file);
+  REQUIRE(file.good());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  file.close();
+  const std::string trace = contents.str();
+  REQUIRE(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") == 0);
+  REQUIRE(trace.find("\"name\":\"INVERT\"") != std::string::npos);
+  REQUIRE(trace.find("\"name\":\"CHUZR\"") != std::string::npos);
+  REQUIRE(trace.find("\"name\":\"PRICE\"") != std::string::npos);
+  std::remove(trace_file.c_str());
+
+  // Without a trace file, nothing is recorded
+  highs.setOptionValue("trace_file", "");
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(HighsTrace::getNumEvents() == num_event);
+
+  auto validTrace = [&]() {
+    std::ifstream file(trace_file);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string trace = contents.str();
+    const std::string end = "\n]}\n";
+    return trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") ==
+               0 &&
+           trace.size() > end.size() &&
+           trace.compare(trace.size() - end.size(), end.size(), end) == 0 &&
+           trace.find("\"name\":\"INVERT\"") != std::string::npos;
+  };
+
+  // A batch is traced as a whole
+  std::vector<HighsModel> models(8, highs.getModel());
+  std::vector<HighsBatchResult> results;
+  highs.setTaskExecutor(Highs::createTaskExecutor(3));
+  highs.setOptionValue("trace_file", trace_file);
+  REQUIRE(highs.solveBatch(models, results) == HighsStatus::kOk);
+  REQUIRE(validTrace());
+  std::remove(trace_file.c_str());
+
+  // Solves running at the same time with the same trace file don't
+  // interfere, since only one of them owns tracing at any time
+  std::vector<std::thread> threads;
+  std::vector<HighsStatus> run_status(4, HighsStatus::kError);
+  for (HighsInt k = 0; k < 4; k++) {
+    threads.emplace_back([&, k]() {
+      Highs thread_highs;
+      thread_highs.setOptionValue("output_flag", false);
+      thread_highs.setTaskExecutor(Highs::createTaskExecutor(1));
+      thread_highs.setOptionValue("trace_file", trace_file);
+      thread_highs.passModel(models[k]);
+      run_status[k] = thread_highs.run();
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  for (const HighsStatus status : run_status)
+    REQUIRE(status == HighsStatus::kOk);
+  REQUIRE(validTrace());
+  std::remove(trace_file.c_str());
+}
+
+TEST_CASE("LP-metrics", "[highs_lp_solver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  std::shared_ptr<const HighsMetrics> metrics = highs.getMetrics();
+  REQUIRE(metrics->snapshot().simplex_iteration_count == 0);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsMetricsSnapshot snapshot = metrics->snapshot();
+  // Bound flips in the primal simplex are iterations without a basis
+  // change, and aren't counted
+  REQUIRE(snapshot.simplex_iteration_count > 0);
+  REQUIRE(snapshot.simplex_iteration_count <=
+          highs.getInfo().simplex_iteration_count);
+  REQUIRE(snapshot.invert_count > 0);
+  REQUIRE(snapshot.invert_time >= 0);
+  int64_t ftran_count = 0;
+  for (HighsInt iBucket = 0; iBucket < kHighsMetricsNumDensityBucket;
+       iBucket++)
+    ftran_count += snapshot.ftran_density_count[iBucket];
+  REQUIRE(ftran_count >= snapshot.simplex_iteration_count);
+  REQUIRE(snapshot.mip_node_count == 0);
+
+  // The metrics are reset by run()
+  highs.clearSolver();
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(metrics->snapshot().simplex_iteration_count <=
+          highs.getInfo().simplex_iteration_count);
+}
@@ -3,6 +3,7 @@
 #include "Highs.h"
 #include "catch.hpp"
 #include "lp_data/HighsLpUtils.h"
+#include "parallel/HighsParallel.h"
 
 const bool dev_run = false;
 const double inf = kHighsInf;
@@ -587,3 +588,72 @@ TEST_CASE("LP-change-coefficient", "[highs_data]") {
                                     highs.getInfo().objective_function_value);
   REQUIRE(delta_objective_value < 1e-8);
 }
+
+TEST_CASE("LP-validation-parallel", "[highs_data]") {
+  // Costs, bounds and matrix entries of a large LP are assessed in
+  // parallel when the scheduler has more than one thread
+  Highs::resetGlobalScheduler(true);
+  highs::parallel::initialize_scheduler(4);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const HighsInt num_col = 100000;
+  const HighsInt num_row = 10;
+  HighsLp lp;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.col_cost_.assign(num_col, 1);
+  lp.col_lower_.assign(num_col, 0);
+  lp.col_upper_.assign(num_col, 1);
+  lp.row_lower_.assign(num_row, 1);
+  lp.row_upper_.assign(num_row, inf);
+  lp.col_cost_[70000] = 1e30;
+  lp.col_lower_[80000] = -1e30;
+  lp.col_upper_[90000] = 1e30;
+  lp.a_matrix_.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    lp.a_matrix_.index_.push_back(iCol % num_row);
+    lp.a_matrix_.index_.push_back((iCol + 1) % num_row);
+    lp.a_matrix_.value_.push_back(1);
+    lp.a_matrix_.value_.push_back(2);
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+  }
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  const HighsLp& highs_lp = highs.getLp();
+  REQUIRE(highs_lp.col_cost_[70000] == inf);
+  REQUIRE(highs_lp.has_infinite_cost_);
+  REQUIRE(highs_lp.col_lower_[80000] == -inf);
+  REQUIRE(highs_lp.col_upper_[90000] == inf);
+  REQUIRE(highs_lp.a_matrix_.numNz() == 2 * num_col);
+
+  // Inconsistent bounds give a warning
+  HighsLp modified_lp = lp;
+  modified_lp.col_lower_[60000] = 2;
+  REQUIRE(highs.passModel(modified_lp) == HighsStatus::kWarning);
+
+  // Small values are removed
+  modified_lp = lp;
+  modified_lp.a_matrix_.value_[2 * 50000] = 1e-12;
+  REQUIRE(highs.passModel(modified_lp) == HighsStatus::kWarning);
+  REQUIRE(highs.getLp().a_matrix_.numNz() == 2 * num_col - 1);
+  REQUIRE(highs.getLp().a_matrix_.index_[2 * 50000] == 1);
+
+  // Duplicate indices are an error
+  modified_lp = lp;
+  modified_lp.a_matrix_.index_[2 * 50000] = 1;
+  REQUIRE(highs.passModel(modified_lp) == HighsStatus::kError);
+
+  // A model read from a trusted .hbin file isn't assessed again
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  const std::string hbin_file = "parallel-validation.hbin";
+  REQUIRE(highs.writeModel(hbin_file) == HighsStatus::kOk);
+  const HighsLp written_lp = highs.getLp();
+  highs.setOptionValue("trust_hbin_model_file", true);
+  REQUIRE(highs.readModel(hbin_file) == HighsStatus::kOk);
+  REQUIRE(highs.getLp().col_cost_ == written_lp.col_cost_);
+  REQUIRE(highs.getLp().col_lower_ == written_lp.col_lower_);
+  REQUIRE(highs.getLp().a_matrix_ == written_lp.a_matrix_);
+  REQUIRE(highs.getLp().has_infinite_cost_);
+  std::remove(hbin_file.c_str());
+
+  Highs::resetGlobalScheduler(true);
+}
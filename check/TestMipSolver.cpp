@@ -1,3 +1,6 @@
+#include <atomic>
+#include <thread>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
@@ -570,6 +573,98 @@ TEST_CASE("MIP-objective-target", "[highs_test_mip_solver]") {
   REQUIRE(highs.getInfo().objective_function_value > egout_optimal_objective);
 }
 
+TEST_CASE("MIP-symmetry-max-delay", "[highs_test_mip_solver]") {
+  // Symmetry detection that is stopped as soon as it is awaited must
+  // not affect the optimal objective
+  const double egout_optimal_objective = 568.1007;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.setOptionValue("mip_symmetry_max_delay_fraction", 0.0) ==
+          HighsStatus::kOk);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    egout_optimal_objective) < double_equal_tolerance);
+}
+
+TEST_CASE("MIP-probing-batch", "[highs_test_mip_solver]") {
+  const double egout_optimal_objective = 568.1007;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.setOptionValue("mip_probing_batch_size", 32) ==
+          HighsStatus::kOk);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    egout_optimal_objective) < double_equal_tolerance);
+}
+
+TEST_CASE("MIP-probing-batch-threads", "[highs_test_mip_solver]") {
+  // Batched probing gives the same result whatever the number of
+  // threads, so the search is the same
+  const std::vector<std::string> models = {"egout", "flugpl", "lseu",
+                                           "p0548"};
+  const std::vector<double> optimal_objective = {568.1007, 1201500, 1120,
+                                                 8691};
+  for (size_t iModel = 0; iModel < models.size(); iModel++) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + models[iModel] + ".mps";
+    int64_t mip_node_count[2];
+    HighsInt simplex_iteration_count[2];
+    for (HighsInt pass = 0; pass < 2; pass++) {
+      Highs highs;
+      highs.setOptionValue("output_flag", dev_run);
+      highs.setOptionValue("mip_probing_batch_size", 32);
+      highs.setTaskExecutor(Highs::createTaskExecutor(pass == 0 ? 1 : 4));
+      highs.readModel(filename);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      const HighsInfo& info = highs.getInfo();
+      REQUIRE(std::fabs(info.objective_function_value -
+                        optimal_objective[iModel]) <
+              1e-6 * std::max(1.0, std::fabs(optimal_objective[iModel])));
+      mip_node_count[pass] = info.mip_node_count;
+      simplex_iteration_count[pass] = info.simplex_iteration_count;
+    }
+    REQUIRE(mip_node_count[0] == mip_node_count[1]);
+    REQUIRE(simplex_iteration_count[0] == simplex_iteration_count[1]);
+  }
+}
+
+TEST_CASE("MIP-root-warm-start", "[highs_test_mip_solver]") {
+  // Re-solving a modified MIP using the root basis and row duals of
+  // the previous solve must give the same optimal objective as
+  // solving it from scratch
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.setOptionValue("mip_root_warm_start", true) ==
+          HighsStatus::kOk);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  const HighsLp& lp = highs.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol += 7)
+    REQUIRE(highs.changeColCost(iCol, 2 * lp.col_cost_[iCol]) ==
+            HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  Highs cold_highs;
+  cold_highs.setOptionValue("output_flag", dev_run);
+  cold_highs.passModel(highs.getLp());
+  cold_highs.run();
+  REQUIRE(cold_highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    cold_highs.getInfo().objective_function_value) <
+          double_equal_tolerance);
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective,
                  const bool dev_run = false) {
@@ -635,3 +730,46 @@ void rowlessMIP(Highs& highs) {
   solve(highs, "on", require_model_status, optimal_objective);
   solve(highs, "off", require_model_status, optimal_objective);
 }
+
+TEST_CASE("mip-metrics", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  std::shared_ptr<const HighsMetrics> metrics = highs.getMetrics();
+  REQUIRE(metrics);
+
+  // Poll the metrics from another thread during the solve, checking
+  // that the node count never decreases
+  std::atomic<bool> solving(true);
+  HighsInt num_snapshot = 0;
+  bool node_count_ok = true;
+  std::thread monitor([&]() {
+    int64_t node_count = 0;
+    while (solving.load()) {
+      const HighsMetricsSnapshot snapshot = metrics->snapshot();
+      if (snapshot.mip_node_count < node_count) node_count_ok = false;
+      node_count = snapshot.mip_node_count;
+      num_snapshot++;
+      std::this_thread::yield();
+    }
+  });
+  highs.run();
+  solving = false;
+  monitor.join();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(num_snapshot > 0);
+  REQUIRE(node_count_ok);
+
+  // The final values are those of the solve
+  const HighsInfo& info = highs.getInfo();
+  const HighsMetricsSnapshot snapshot = metrics->snapshot();
+  REQUIRE(snapshot.mip_node_count == info.mip_node_count);
+  REQUIRE(snapshot.mip_open_node_count == 0);
+  REQUIRE(snapshot.mip_lp_iteration_count > 0);
+  REQUIRE(std::fabs(snapshot.mip_primal_bound - info.objective_function_value) <
+          double_equal_tolerance);
+  REQUIRE(snapshot.mip_dual_bound <= snapshot.mip_primal_bound);
+  REQUIRE(snapshot.mip_gap <= 100 * highs.getOptions().mip_rel_gap);
+  REQUIRE(snapshot.run_time > 0);
+}
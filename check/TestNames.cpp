@@ -118,3 +118,27 @@ TEST_CASE("highs-names", "[highs_names]") {
 
   std::remove(solution_file.c_str());
 }
+
+TEST_CASE("highs-names-hash", "[highs_names]") {
+  // Enough names to force the hash to grow several times
+  const HighsInt num_name = 1000;
+  std::vector<std::string> name;
+  for (HighsInt ix = 0; ix < num_name; ix++)
+    name.push_back("x" + std::to_string(ix));
+  HighsNameHash hash;
+  hash.form(name);
+  REQUIRE(hash.size() == num_name);
+  for (HighsInt ix = 0; ix < num_name; ix++)
+    REQUIRE(hash.find(name, name[ix]) == ix);
+  REQUIRE(hash.find(name, "y0") == kHashNotFound);
+  REQUIRE(!hash.hasDuplicate(name));
+
+  // Duplicate names are identified, and other names are unaffected
+  name.push_back("x7");
+  REQUIRE(hash.hasDuplicate(name));
+  hash.form(name);
+  REQUIRE(hash.find(name, "x7") == kHashIsDuplicate);
+  REQUIRE(hash.find(name, "x8") == 8);
+  hash.clear();
+  REQUIRE(hash.find(name, "x8") == kHashNotFound);
+}
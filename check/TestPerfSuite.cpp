@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <fstream>
+
+#include "HCheckConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "lp_data/HighsPerfSuite.h"
+
+const bool dev_run = false;
+
+TEST_CASE("perf-suite-run", "[highs_perf_suite]") {
+  const std::string suite_file = "perf_suite_test.txt";
+  const std::string report_file = "perf_suite_test.csv";
+  std::ofstream suite(suite_file);
+  suite << "# LP, QP and MIP\n"
+        << std::string(HIGHS_DIR) << "/check/instances/afiro.mps\n"
+        << "\n"
+        << std::string(HIGHS_DIR) << "/check/instances/qjh.mps\n"
+        << std::string(HIGHS_DIR) << "/check/instances/flugpl.mps\n";
+  suite.close();
+
+  std::vector<std::string> model_files;
+  REQUIRE(readPerfSuite(suite_file, model_files));
+  REQUIRE(model_files.size() == 3);
+
+  HighsOptions options;
+  options.output_flag = dev_run;
+  HighsPerfSuiteSettings settings;
+  settings.suite_file = suite_file;
+  settings.report_file = report_file;
+  settings.num_repeat = 2;
+  REQUIRE(runPerfSuite(settings, options) == HighsStatus::kOk);
+
+  std::vector<HighsPerfRecord> report;
+  REQUIRE(readPerfReport(report_file, report));
+  REQUIRE(report.size() == 6);
+  REQUIRE(report[0].model == "afiro");
+  REQUIRE(report[1].repeat == 1);
+  REQUIRE(report[0].model_status == "Optimal");
+  REQUIRE(report[0].simplex_iteration_count > 0);
+  REQUIRE(report[0].invert_count > 0);
+  REQUIRE(report[2].model == "qjh");
+  REQUIRE(report[2].model_status == "Optimal");
+  REQUIRE(report[2].qp_iteration_count > 0);
+  // The phase times and INVERT statistics of a MIP aren't known
+  REQUIRE(report[4].model == "flugpl");
+  REQUIRE(report[4].model_status == "Optimal");
+  REQUIRE(report[4].run_time > 0);
+  REQUIRE(report[4].mip_node_count > 0);
+  REQUIRE(report[4].presolve_time == -1);
+  REQUIRE(report[4].solve_time == -1);
+  REQUIRE(report[4].postsolve_time == -1);
+  REQUIRE(report[4].invert_count == -1);
+  REQUIRE(report[4].invert_time == -1);
+  // Deterministic statistics are the same for each repeat
+  REQUIRE(report[0].simplex_iteration_count ==
+          report[1].simplex_iteration_count);
+
+  // A report compared with itself has no slowdown
+  settings.suite_file = "";
+  settings.compare_file = report_file;
+  REQUIRE(runPerfSuite(settings, options) == HighsStatus::kOk);
+
+  // Models with the same name in different formats can't both be in
+  // a suite, since records are identified by the model name
+  suite.open(suite_file);
+  suite << std::string(HIGHS_DIR) << "/check/instances/afiro.mps\n"
+        << "afiro.lp\n";
+  suite.close();
+  REQUIRE(!readPerfSuite(suite_file, model_files));
+  settings.compare_file = "";
+  settings.suite_file = suite_file;
+  REQUIRE(runPerfSuite(settings, options) == HighsStatus::kError);
+
+  std::remove(suite_file.c_str());
+  std::remove(report_file.c_str());
+}
+
+TEST_CASE("perf-suite-compare", "[highs_perf_suite]") {
+  HighsOptions options;
+  options.output_flag = dev_run;
+  const HighsLogOptions& log_options = options.log_options;
+  std::vector<HighsPerfRecord> baseline;
+  std::vector<HighsPerfRecord> report;
+  const double baseline_time[] = {1.00, 1.02, 0.98, 1.01, 0.99};
+  const double noise_time[] = {1.01, 0.99, 1.03, 0.98, 1.00};
+  for (HighsInt repeat = 0; repeat < 5; repeat++) {
+    HighsPerfRecord record;
+    record.model = "model";
+    record.repeat = repeat;
+    record.run_time = baseline_time[repeat];
+    baseline.push_back(record);
+    record.run_time = noise_time[repeat];
+    report.push_back(record);
+  }
+  // Differences within the noise are not flagged
+  REQUIRE(comparePerfReports(log_options, baseline, report) ==
+          HighsStatus::kOk);
+
+  // A consistent 20% increase in run time is flagged
+  for (HighsPerfRecord& record : report) record.run_time *= 1.2;
+  REQUIRE(comparePerfReports(log_options, baseline, report) ==
+          HighsStatus::kWarning);
+
+  // An increase in the mean run time due to a single outlier is not
+  // significant
+  report = baseline;
+  report[0].run_time = 2;
+  REQUIRE(comparePerfReports(log_options, baseline, report) ==
+          HighsStatus::kOk);
+}
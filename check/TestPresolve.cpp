@@ -79,6 +79,60 @@ TEST_CASE("presolve", "[highs_test_presolve]") {
   REQUIRE(presolved_model.isEmpty());
 }
 
+TEST_CASE("presolve-then-run", "[highs_test_presolve]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs0;
+  highs0.setOptionValue("output_flag", dev_run);
+  highs0.readModel(model_file);
+  highs0.run();
+  const double objective_value = highs0.getInfo().objective_function_value;
+
+  // Running after presolving the unmodified LP uses the result of
+  // presolve, so the presolve status is retained
+  Highs highs1;
+  highs1.setOptionValue("output_flag", dev_run);
+  highs1.readModel(model_file);
+  REQUIRE(highs1.presolve() == HighsStatus::kOk);
+  REQUIRE(highs1.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+  REQUIRE(highs1.run() == HighsStatus::kOk);
+  REQUIRE(highs1.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs1.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+  REQUIRE(std::fabs(highs1.getInfo().objective_function_value -
+                    objective_value) < 1e-8);
+
+  // Modifying the LP after presolving it means that it's presolved
+  // again
+  REQUIRE(highs1.clearSolver() == HighsStatus::kOk);
+  REQUIRE(highs1.presolve() == HighsStatus::kOk);
+  const HighsLp& lp = highs1.getLp();
+  const double cost0 = lp.col_cost_[0];
+  REQUIRE(highs1.changeColCost(0, cost0 + 1) == HighsStatus::kOk);
+  REQUIRE(highs1.changeColCost(0, cost0) == HighsStatus::kOk);
+  REQUIRE(highs1.getModelPresolveStatus() ==
+          HighsPresolveStatus::kNotPresolved);
+  REQUIRE(highs1.run() == HighsStatus::kOk);
+  REQUIRE(highs1.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs1.getInfo().objective_function_value -
+                    objective_value) < 1e-8);
+
+  // Changing an option after presolving the LP means that it's
+  // presolved again with the new option values
+  Highs highs2;
+  highs2.setOptionValue("output_flag", dev_run);
+  highs2.readModel(model_file);
+  REQUIRE(highs2.presolve() == HighsStatus::kOk);
+  REQUIRE(highs2.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+  REQUIRE(highs2.setOptionValue("presolve_reduction_limit", 0) ==
+          HighsStatus::kOk);
+  REQUIRE(highs2.run() == HighsStatus::kOk);
+  REQUIRE(highs2.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs2.getModelPresolveStatus() ==
+          HighsPresolveStatus::kNotReduced);
+  REQUIRE(std::fabs(highs2.getInfo().objective_function_value -
+                    objective_value) < 1e-8);
+}
+
 void presolveSolvePostsolve(const std::string& model_file,
                             const bool solve_relaxation) {
   Highs highs0;
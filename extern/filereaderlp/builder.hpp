@@ -8,17 +8,21 @@
 #include "model.hpp"
 
 struct Builder {
-  std::unordered_map<std::string, std::shared_ptr<Variable>> variables;
+  std::unordered_map<std::string, unsigned int> varindex;
 
   Model model;
 
+  unsigned int getvarindex(const std::string& name) {
+    auto it = varindex.find(name);
+    if (it != varindex.end()) return it->second;
+    unsigned int index = model.variables.size();
+    varindex.insert(std::make_pair(name, index));
+    model.variables.push_back(std::shared_ptr<Variable>(new Variable(name)));
+    return index;
+  }
+
   std::shared_ptr<Variable> getvarbyname(const std::string& name) {
-    auto it = variables.find(name);
-    if (it != variables.end()) return it->second;
-    auto newvar = std::shared_ptr<Variable>(new Variable(name));
-    variables.insert(std::make_pair(name, newvar));
-    model.variables.push_back(newvar);
-    return newvar;
+    return model.variables[getvarindex(name)];
   }
 };
 
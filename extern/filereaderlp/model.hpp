@@ -25,20 +25,22 @@ struct Variable {
   Variable(std::string n = "") : name(n){};
 };
 
+// terms refer to variables by their index in Model::variables, and are
+// stored by value so that an expression is a flat array of terms
 struct LinTerm {
-  std::shared_ptr<Variable> var;
+  unsigned int var;
   double coef = 1.0;
 };
 
 struct QuadTerm {
-  std::shared_ptr<Variable> var1;
-  std::shared_ptr<Variable> var2;
+  unsigned int var1;
+  unsigned int var2;
   double coef = 1.0;
 };
 
 struct Expression {
-  std::vector<std::shared_ptr<LinTerm>> linterms;
-  std::vector<std::shared_ptr<QuadTerm>> quadterms;
+  std::vector<LinTerm> linterms;
+  std::vector<QuadTerm> quadterms;
   double offset = 0.0;
   std::string name = "";
 };
@@ -46,9 +48,7 @@ struct Expression {
 struct Constraint {
   double lowerbound = -std::numeric_limits<double>::infinity();
   double upperbound = std::numeric_limits<double>::infinity();
-  std::shared_ptr<Expression> expr;
-
-  Constraint() : expr(std::shared_ptr<Expression>(new Expression)){};
+  Expression expr;
 };
 
 struct SOS {
@@ -58,9 +58,9 @@ struct SOS {
 };
 
 struct Model {
-  std::shared_ptr<Expression> objective;
+  Expression objective;
   ObjectiveSense sense;
-  std::vector<std::shared_ptr<Constraint>> constraints;
+  std::vector<Constraint> constraints;
   std::vector<std::shared_ptr<Variable>> variables;
   std::vector<std::shared_ptr<SOS>> soss;
 };
@@ -208,11 +208,7 @@ struct ProcessedToken {
 const double kHighsInf = std::numeric_limits<double>::infinity();
 class Reader {
  private:
-#ifdef ZLIB_FOUND
-  zstr::ifstream file;
-#else
-  std::ifstream file;
-#endif
+  std::istream& file;
   std::string linebuffer;
   std::size_t linebufferpos;
   std::array<RawToken, NRAWTOKEN> rawtokens;
@@ -241,31 +237,34 @@ class Reader {
   void processendsec();
   void parseexpression(std::vector<ProcessedToken>::iterator& it,
                        std::vector<ProcessedToken>::iterator end,
-                       std::shared_ptr<Expression> expr, bool isobj);
+                       Expression& expr, bool isobj);
 
  public:
-  Reader(std::string filename) {
-#ifdef ZLIB_FOUND
-    try {
-      file.open(filename);
-    } catch (const strict_fstream::Exception& e) {
-    }
-#else
-    file.open(filename);
-#endif
-    lpassert(file.is_open());
-  };
-
-  ~Reader() { file.close(); }
+  Reader(std::istream& stream) : file(stream) { lpassert(file.good()); };
 
   Model read();
 };
 
-Model readinstance(std::string filename) {
-  Reader reader(filename);
+Model readinstance(std::istream& file) {
+  Reader reader(file);
   return reader.read();
 }
 
+Model readinstance(std::string filename) {
+#ifdef ZLIB_FOUND
+  zstr::ifstream file;
+  try {
+    file.open(filename);
+  } catch (const strict_fstream::Exception& e) {
+  }
+#else
+  std::ifstream file;
+  file.open(filename);
+#endif
+  lpassert(file.is_open());
+  return readinstance(file);
+}
+
 // convert string to lower-case, modifies string
 static inline void tolower(std::string& s) {
   std::transform(s.begin(), s.end(), s.begin(),
@@ -338,9 +337,9 @@ void Reader::processnonesec() {
 
 void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
                              std::vector<ProcessedToken>::iterator end,
-                             std::shared_ptr<Expression> expr, bool isobj) {
+                             Expression& expr, bool isobj) {
   if (it != end && it->type == ProcessedTokenType::CONID) {
-    expr->name = it->name;
+    expr.name = it->name;
     ++it;
   }
 
@@ -352,13 +351,12 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
         next->type == ProcessedTokenType::VARID) {
       std::string name = next->name;
 
-      std::shared_ptr<LinTerm> linterm =
-          std::shared_ptr<LinTerm>(new LinTerm());
-      linterm->coef = it->value;
-      linterm->var = builder.getvarbyname(name);
-      //	 printf("LpReader: Term   %+g %s\n", linterm->coef,
+      LinTerm linterm;
+      linterm.coef = it->value;
+      linterm.var = builder.getvarindex(name);
+      //	 printf("LpReader: Term   %+g %s\n", linterm.coef,
       //name.c_str());
-      expr->linterms.push_back(linterm);
+      expr.linterms.push_back(linterm);
 
       ++it;
       ++it;
@@ -367,8 +365,8 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 
     // const
     if (it->type == ProcessedTokenType::CONST) {
-      //      printf("LpReader: Offset change from %+g by %+g\n", expr->offset, it->value);
-      expr->offset += it->value;
+      //      printf("LpReader: Offset change from %+g by %+g\n", expr.offset, it->value);
+      expr.offset += it->value;
       ++it;
       continue;
     }
@@ -377,13 +375,12 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
     if (it->type == ProcessedTokenType::VARID) {
       std::string name = it->name;
 
-      std::shared_ptr<LinTerm> linterm =
-          std::shared_ptr<LinTerm>(new LinTerm());
-      linterm->coef = 1.0;
-      linterm->var = builder.getvarbyname(name);
-      //	 printf("LpReader: Term   %+g %s\n", linterm->coef,
+      LinTerm linterm;
+      linterm.coef = 1.0;
+      linterm.var = builder.getvarindex(name);
+      //	 printf("LpReader: Term   %+g %s\n", linterm.coef,
       //name.c_str());
-      expr->linterms.push_back(linterm);
+      expr.linterms.push_back(linterm);
 
       ++it;
       continue;
@@ -414,12 +411,11 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 
           lpassert(next3->value == 2.0);
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = it->value;
-          quadterm->var1 = builder.getvarbyname(name);
-          quadterm->var2 = builder.getvarbyname(name);
-          expr->quadterms.push_back(quadterm);
+          QuadTerm quadterm;
+          quadterm.coef = it->value;
+          quadterm.var1 = builder.getvarindex(name);
+          quadterm.var2 = quadterm.var1;
+          expr.quadterms.push_back(quadterm);
 
           it = ++next3;
           continue;
@@ -433,12 +429,11 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 
           lpassert(next2->value == 2.0);
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = 1.0;
-          quadterm->var1 = builder.getvarbyname(name);
-          quadterm->var2 = builder.getvarbyname(name);
-          expr->quadterms.push_back(quadterm);
+          QuadTerm quadterm;
+          quadterm.coef = 1.0;
+          quadterm.var1 = builder.getvarindex(name);
+          quadterm.var2 = quadterm.var1;
+          expr.quadterms.push_back(quadterm);
 
           it = next3;
           continue;
@@ -452,12 +447,11 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
           std::string name1 = next1->name;
           std::string name2 = next3->name;
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = it->value;
-          quadterm->var1 = builder.getvarbyname(name1);
-          quadterm->var2 = builder.getvarbyname(name2);
-          expr->quadterms.push_back(quadterm);
+          QuadTerm quadterm;
+          quadterm.coef = it->value;
+          quadterm.var1 = builder.getvarindex(name1);
+          quadterm.var2 = builder.getvarindex(name2);
+          expr.quadterms.push_back(quadterm);
 
           it = ++next3;
           continue;
@@ -470,12 +464,11 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
           std::string name1 = it->name;
           std::string name2 = next2->name;
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = 1.0;
-          quadterm->var1 = builder.getvarbyname(name1);
-          quadterm->var2 = builder.getvarbyname(name2);
-          expr->quadterms.push_back(quadterm);
+          QuadTerm quadterm;
+          quadterm.coef = 1.0;
+          quadterm.var1 = builder.getvarindex(name1);
+          quadterm.var2 = builder.getvarindex(name2);
+          expr.quadterms.push_back(quadterm);
 
           it = next3;
           continue;
@@ -510,7 +503,7 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 }
 
 void Reader::processobjsec() {
-  builder.model.objective = std::shared_ptr<Expression>(new Expression);
+  builder.model.objective = Expression();
   if (sectiontokens.count(LpSectionKeyword::OBJMIN)) {
     builder.model.sense = ObjectiveSense::MIN;
     parseexpression(sectiontokens[LpSectionKeyword::OBJMIN].first,
@@ -537,9 +530,9 @@ void Reader::processconsec() {
   std::vector<ProcessedToken>::iterator& end(
       sectiontokens[LpSectionKeyword::CON].second);
   while (begin != end) {
-    std::shared_ptr<Constraint> con =
-        std::shared_ptr<Constraint>(new Constraint);
-    parseexpression(begin, end, con->expr, false);
+    builder.model.constraints.emplace_back();
+    Constraint& con = builder.model.constraints.back();
+    parseexpression(begin, end, con.expr, false);
     // should not be at end of section yet, but a comparison operator should be
     // next
     lpassert(begin != sectiontokens[LpSectionKeyword::CON].second);
@@ -553,18 +546,17 @@ void Reader::processconsec() {
     lpassert(begin->type == ProcessedTokenType::CONST);
     switch (dir) {
       case LpComparisonType::EQ:
-        con->lowerbound = con->upperbound = begin->value;
+        con.lowerbound = con.upperbound = begin->value;
         break;
       case LpComparisonType::LEQ:
-        con->upperbound = begin->value;
+        con.upperbound = begin->value;
         break;
       case LpComparisonType::GEQ:
-        con->lowerbound = begin->value;
+        con.lowerbound = begin->value;
         break;
       default:
         lpassert(false);
     }
-    builder.model.constraints.push_back(con);
     ++begin;
   }
 }
@@ -1190,6 +1182,9 @@ bool Reader::readnexttoken(RawToken& t) {
       t = RawTokenType::FLEND;
       return true;
     }
+    // a read error, such as corrupt compressed data, leaves the stream
+    // bad without reaching the end of the file
+    lpassert(this->file.good());
     std::getline(this->file, linebuffer);
 
     // drop \r
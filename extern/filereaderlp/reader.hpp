@@ -1,10 +1,12 @@
 #ifndef __READERLP_READER_HPP__
 #define __READERLP_READER_HPP__
 
+#include <istream>
 #include <string>
 
 #include "model.hpp"
 
 Model readinstance(std::string filename);
+Model readinstance(std::istream& file);
 
 #endif
@@ -738,9 +738,16 @@ PYBIND11_MODULE(_highs, m) {
       .def_readwrite("objective_target", &HighsOptions::objective_target)
       .def_readwrite("random_seed", &HighsOptions::random_seed)
       .def_readwrite("threads", &HighsOptions::threads)
+      .def_readwrite("thread_affinity", &HighsOptions::thread_affinity)
+      .def_readwrite("numa_aware_stealing",
+                     &HighsOptions::numa_aware_stealing)
+      .def_readwrite("idle_policy", &HighsOptions::idle_policy)
+      .def_readwrite("idle_spin_microseconds",
+                     &HighsOptions::idle_spin_microseconds)
       .def_readwrite("highs_debug_level", &HighsOptions::highs_debug_level)
       .def_readwrite("highs_analysis_level",
                      &HighsOptions::highs_analysis_level)
+      .def_readwrite("trace_file", &HighsOptions::trace_file)
       .def_readwrite("simplex_strategy", &HighsOptions::simplex_strategy)
       .def_readwrite("simplex_scale_strategy",
                      &HighsOptions::simplex_scale_strategy)
@@ -772,6 +779,8 @@ PYBIND11_MODULE(_highs, m) {
       .def_readwrite("log_dev_level", &HighsOptions::log_dev_level)
       .def_readwrite("allow_unbounded_or_infeasible",
                      &HighsOptions::allow_unbounded_or_infeasible)
+      .def_readwrite("trust_hbin_model_file",
+                     &HighsOptions::trust_hbin_model_file)
       .def_readwrite("allowed_matrix_scale_factor",
                      &HighsOptions::allowed_matrix_scale_factor)
       .def_readwrite("ipx_dualize_strategy",
@@ -783,6 +792,8 @@ PYBIND11_MODULE(_highs, m) {
       .def_readwrite("simplex_price_strategy",
                      &HighsOptions::simplex_price_strategy)
       .def_readwrite("mip_detect_symmetry", &HighsOptions::mip_detect_symmetry)
+      .def_readwrite("mip_symmetry_max_delay_fraction",
+                     &HighsOptions::mip_symmetry_max_delay_fraction)
       .def_readwrite("mip_max_nodes", &HighsOptions::mip_max_nodes)
       .def_readwrite("mip_max_stall_nodes", &HighsOptions::mip_max_stall_nodes)
       .def_readwrite("mip_max_leaves", &HighsOptions::mip_max_leaves)
@@ -795,6 +806,9 @@ PYBIND11_MODULE(_highs, m) {
                      &HighsOptions::mip_pscost_minreliable)
       .def_readwrite("mip_min_cliquetable_entries_for_parallelism",
                      &HighsOptions::mip_min_cliquetable_entries_for_parallelism)
+      .def_readwrite("mip_probing_batch_size",
+                     &HighsOptions::mip_probing_batch_size)
+      .def_readwrite("mip_root_warm_start", &HighsOptions::mip_root_warm_start)
       .def_readwrite("mip_report_level", &HighsOptions::mip_report_level)
       .def_readwrite("mip_feasibility_tolerance",
                      &HighsOptions::mip_feasibility_tolerance)
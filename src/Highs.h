@@ -14,13 +14,16 @@
 #ifndef HIGHS_H_
 #define HIGHS_H_
 
+#include <future>
 #include <sstream>
 
 #include "lp_data/HighsCallback.h"
+#include "lp_data/HighsLpBuilder.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
 #include "model/HighsModel.h"
+#include "parallel/HighsTaskExecutor.h"
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
 
@@ -39,6 +42,17 @@ HighsInt highsVersionPatch();
 const char* highsGithash();
 const char* highsCompilationDate();
 
+/**
+ * @brief Outcome of solving one model of a batch
+ */
+struct HighsBatchResult {
+  HighsStatus run_status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  HighsInfo info;
+  HighsSolution solution;
+  HighsBasis basis;
+};
+
 /**
  * @brief Class to set parameters and run HiGHS
  */
@@ -104,18 +118,39 @@ class Highs {
 
   /**
    * Every model loading module eventually uses
-   * passModel(HighsModel model) to communicate the model to HiGHS.
+   * passModel(HighsModel&& model) to communicate the model to HiGHS.
+   */
+
+  /**
+   * @brief Pass a copy of a HighsModel instance to Highs
+   */
+  HighsStatus passModel(const HighsModel& model);
+
+  /**
+   * @brief Pass a HighsModel instance to Highs, moving its data
+   * rather than copying it. Unless the constraint matrix is row-wise,
+   * the arrays of the model become those of the incumbent model, so
+   * the peak memory use is that of one model. The model passed is
+   * left in a valid but unspecified state
+   */
+  HighsStatus passModel(HighsModel&& model);
+
+  /**
+   * @brief Pass a copy of a HighsLp instance to Highs
    */
+  HighsStatus passModel(const HighsLp& lp);
 
   /**
-   * @brief Pass a HighsModel instance to Highs
+   * @brief Pass a HighsLp instance to Highs, moving its data rather
+   * than copying it, as for passModel(HighsModel&& model)
    */
-  HighsStatus passModel(HighsModel model);
+  HighsStatus passModel(HighsLp&& lp);
 
   /**
-   * @brief Pass a HighsLp instance to Highs
+   * @brief Pass the LP held by a HighsLpBuilder instance to Highs,
+   * leaving the builder empty
    */
-  HighsStatus passModel(HighsLp lp);
+  HighsStatus passModel(HighsLpBuilder& builder);
 
   /**
    * @brief Pass a QP (possibly with integrality data) via pointers to vectors
@@ -185,6 +220,18 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solve a batch of independent models concurrently, one
+   * model per task on the task executor, using the options of this
+   * instance but without logging. The incumbent model is not
+   * changed. Each task takes a solver instance from a pool, so the
+   * number of instances created is at most the number of models
+   * being solved at any time, and their workspaces are reused from
+   * one model to the next. Returns the worst of the run statuses
+   */
+  HighsStatus solveBatch(const std::vector<HighsModel>& models,
+                         std::vector<HighsBatchResult>& results);
+
   /**
    * @brief Postsolve the incumbent model using a solution
    */
@@ -201,6 +248,20 @@ class Highs {
   HighsStatus writeSolution(const std::string& filename,
                             const HighsInt style = kSolutionStyleRaw);
 
+  /**
+   * @brief Write the current solution to a file in a given style on
+   * a background thread. The file is opened, and any ranging
+   * information is computed, before returning. The data written are
+   * a snapshot, so the model may be modified and solved again while
+   * the file is being written. Writing to stdout (filename "") isn't
+   * supported. The write runs on a detached thread, so discarding the
+   * future doesn't make the write synchronous, but the future must be
+   * waited on to know that the file is complete, and before the
+   * program exits
+   */
+  std::future<HighsStatus> writeSolutionAsync(
+      const std::string& filename, const HighsInt style = kSolutionStyleRaw);
+
   /**
    * @brief Read a HiGHS solution file in a given style
    */
@@ -389,6 +450,22 @@ class Highs {
    */
   double getRunTime() { return timer_.readRunHighsClock(); }
 
+  /**
+   * @brief Get the time spent in presolve
+   */
+  double getPresolveTime() { return timer_.read(timer_.presolve_clock); }
+
+  /**
+   * @brief Get the time spent solving LPs, including the presolved LP
+   * and the LP after postsolve
+   */
+  double getSolveTime() { return timer_.read(timer_.solve_clock); }
+
+  /**
+   * @brief Get the time spent in postsolve
+   */
+  double getPostsolveTime() { return timer_.read(timer_.postsolve_clock); }
+
   /**
    * Methods for model output
    */
@@ -744,6 +821,14 @@ class Highs {
    */
   HighsStatus writeBasis(const std::string& filename = "");
 
+  /**
+   * @brief Write a snapshot of the internal HighsBasis instance to a
+   * file on a background thread. Writing to stdout (filename "")
+   * isn't supported. As for writeSolutionAsync, the future must be
+   * waited on to know that the file is complete
+   */
+  std::future<HighsStatus> writeBasisAsync(const std::string& filename);
+
   /**
    * Methods for incumbent model modification
    */
@@ -1086,6 +1171,62 @@ class Highs {
    */
   static void resetGlobalScheduler(bool blocking = false);
 
+  /**
+   * @brief Create a task executor with its own num_threads threads,
+   * or half the number of hardware threads if num_threads is
+   * zero. Returns nullptr if num_threads is negative. The executor can
+   * be attached to any number of Highs instances, and its threads
+   * terminate once the last reference to it has been released. Its
+   * placement of threads and idle policy are given by config, as
+   * obtained from options by schedulerConfig()
+   */
+  static std::shared_ptr<HighsTaskExecutor::ExecutorHandle>
+  createTaskExecutor(
+      const HighsInt num_threads = 0,
+      const HighsSchedulerConfig& config = HighsSchedulerConfig());
+
+  /**
+   * @brief The task executor settings given by the options
+   * thread_affinity, numa_aware_stealing, idle_policy and
+   * idle_spin_microseconds
+   */
+  static HighsSchedulerConfig schedulerConfig(const HighsOptions& options);
+
+  /**
+   * @brief Attach a task executor to this instance, so that run() and
+   * presolve() use it rather than the scheduler of the calling
+   * thread, and the option value for the number of threads is not
+   * used. Instances sharing an executor run one at a time. Passing
+   * nullptr detaches any executor
+   */
+  HighsStatus setTaskExecutor(
+      std::shared_ptr<HighsTaskExecutor::ExecutorHandle> task_executor);
+
+  std::shared_ptr<HighsTaskExecutor::ExecutorHandle> getTaskExecutor() const {
+    return task_executor_;
+  }
+
+  /**
+   * @brief Draw the vectors of the simplex solvers from workspace, so
+   * that they keep their storage from one solve to the next. A
+   * workspace can be shared by any number of Highs instances,
+   * including those that run concurrently. Passing nullptr gives this
+   * instance a new workspace of its own
+   */
+  void setSimplexWorkspace(std::shared_ptr<HighsSimplexWorkspace> workspace);
+
+  std::shared_ptr<HighsSimplexWorkspace> getSimplexWorkspace() const {
+    return ekk_instance_.workspace_;
+  }
+
+  /**
+   * @brief Get the live metrics of this instance. They are reset when
+   * run() is called, and updated as it progresses. A snapshot can be
+   * taken at any time, including by another thread while run() is
+   * executing
+   */
+  std::shared_ptr<const HighsMetrics> getMetrics() const { return metrics_; }
+
   // Start of advanced methods for HiGHS MIP solver
   /**
    * @brief Get the hot start basis data from the most recent simplex
@@ -1282,6 +1423,21 @@ class Highs {
 
   HighsPresolveStatus model_presolve_status_ =
       HighsPresolveStatus::kNotPresolved;
+  // Whether presolve_ holds the result of LP presolve for the
+  // incumbent model that has not yet been used to solve it, so that
+  // run() need not presolve the model again
+  bool lp_presolve_reusable_ = false;
+  // Whether the model being passed has been read from a trusted
+  // file, so passModel need not assess it
+  bool model_is_trusted_ = false;
+  // Executor used by run() and presolve() in place of the scheduler
+  // of the calling thread
+  std::shared_ptr<HighsTaskExecutor::ExecutorHandle> task_executor_;
+  std::shared_ptr<HighsMetrics> metrics_;
+  // Root LP basis and row duals of the last MIP solve, used to warm
+  // start the next MIP solve when mip_root_warm_start is set
+  HighsBasis mip_root_basis_;
+  std::vector<double> mip_root_row_dual_;
   HighsModelStatus model_status_ = HighsModelStatus::kNotset;
 
   HEkk ekk_instance_;
@@ -1336,6 +1492,9 @@ class Highs {
   // Clears the presolved model and its status
   void clearPresolve();
   //
+  // Actions to take when options are changed
+  void optionChangeAction();
+  //
   // Methods to clear solver data for users in Highs class members
   // before (possibly) updating them with data from trying to solve
   // the incumbent model.
@@ -1368,6 +1527,9 @@ class Highs {
 
   HighsStatus returnFromWriteSolution(FILE* file,
                                       const HighsStatus return_status);
+  // Report the statistics of the workers of the task executor when
+  // returning from run()
+  void reportTaskExecutorStats();
   HighsStatus returnFromRun(const HighsStatus return_status,
                             const bool undo_mods);
   HighsStatus returnFromHighs(const HighsStatus return_status);
@@ -248,6 +248,79 @@ HighsInt Highs_passHessian(void* highs, const HighsInt dim,
       ->passHessian(dim, num_nz, format, start, index, value);
 }
 
+void* Highs_lpBuilderCreate(void) { return new HighsLpBuilder(); }
+
+void Highs_lpBuilderDestroy(void* builder) { delete (HighsLpBuilder*)builder; }
+
+HighsInt Highs_lpBuilderReserve(void* builder, const HighsInt num_col,
+                                const HighsInt num_row, const HighsInt num_nz) {
+  ((HighsLpBuilder*)builder)->reserve(num_col, num_row, num_nz);
+  return kHighsStatusOk;
+}
+
+HighsInt Highs_lpBuilderAllocate(void* builder, const HighsInt num_col,
+                                 const HighsInt num_row, const HighsInt num_nz,
+                                 double** col_cost, double** col_lower,
+                                 double** col_upper, double** row_lower,
+                                 double** row_upper, HighsInt** a_start,
+                                 HighsInt** a_index, double** a_value) {
+  if (num_col < 0 || num_row < 0 || num_nz < 0) return kHighsStatusError;
+  HighsLp& lp = ((HighsLpBuilder*)builder)->allocate(num_col, num_row, num_nz);
+  *col_cost = lp.col_cost_.data();
+  *col_lower = lp.col_lower_.data();
+  *col_upper = lp.col_upper_.data();
+  *row_lower = lp.row_lower_.data();
+  *row_upper = lp.row_upper_.data();
+  *a_start = lp.a_matrix_.start_.data();
+  *a_index = lp.a_matrix_.index_.data();
+  *a_value = lp.a_matrix_.value_.data();
+  return kHighsStatusOk;
+}
+
+HighsInt Highs_lpBuilderAddCols(void* builder, const HighsInt num_new_col,
+                                const double* costs, const double* lower,
+                                const double* upper, const HighsInt num_new_nz,
+                                const HighsInt* starts, const HighsInt* index,
+                                const double* value) {
+  return (HighsInt)((HighsLpBuilder*)builder)
+      ->addCols(num_new_col, costs, lower, upper, num_new_nz, starts, index,
+                value);
+}
+
+HighsInt Highs_lpBuilderAddRows(void* builder, const HighsInt num_new_row,
+                                const double* lower, const double* upper,
+                                const HighsInt num_new_nz,
+                                const HighsInt* starts, const HighsInt* index,
+                                const double* value) {
+  return (HighsInt)((HighsLpBuilder*)builder)
+      ->addRows(num_new_row, lower, upper, num_new_nz, starts, index, value);
+}
+
+HighsInt Highs_lpBuilderAddEntries(void* builder, const HighsInt num_new_nz,
+                                   const HighsInt* row, const HighsInt* col,
+                                   const double* value) {
+  return (HighsInt)((HighsLpBuilder*)builder)
+      ->addEntries(num_new_nz, row, col, value);
+}
+
+HighsInt Highs_lpBuilderSetIntegrality(void* builder, const HighsInt col,
+                                       const HighsInt integrality) {
+  return (HighsInt)((HighsLpBuilder*)builder)
+      ->setIntegrality(col, HighsVarType(integrality));
+}
+
+HighsInt Highs_lpBuilderSetObjective(void* builder, const HighsInt sense,
+                                     const double offset) {
+  HighsLpBuilder* lp_builder = (HighsLpBuilder*)builder;
+  lp_builder->setObjectiveSense((ObjSense)sense);
+  lp_builder->setObjectiveOffset(offset);
+  return kHighsStatusOk;
+}
+
+HighsInt Highs_passLpBuilder(void* highs, void* builder) {
+  return (HighsInt)((Highs*)highs)->passModel(*(HighsLpBuilder*)builder);
+}
+
 HighsInt Highs_passRowName(const void* highs, const HighsInt row,
                            const char* name) {
   return (HighsInt)((Highs*)highs)->passRowName(row, std::string(name));
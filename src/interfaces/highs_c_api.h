@@ -476,6 +476,175 @@ HighsInt Highs_passHessian(void* highs, const HighsInt dim,
                            const HighsInt* start, const HighsInt* index,
                            const double* value);
 
+/**
+ * Create an LP builder and return the reference. Columns, rows and
+ * constraint matrix entries are added to the builder incrementally,
+ * and the LP is formed once, when it is passed to a Highs instance
+ * by `Highs_passLpBuilder`.
+ *
+ * Call `Highs_lpBuilderDestroy` on the returned reference to clean up
+ * allocated memory.
+ *
+ * @returns A pointer to the LP builder.
+ */
+void* Highs_lpBuilderCreate(void);
+
+/**
+ * Destroy the LP builder `builder` created by `Highs_lpBuilderCreate`
+ * and free all corresponding memory.
+ *
+ * @param builder   A pointer to the LP builder.
+ */
+void Highs_lpBuilderDestroy(void* builder);
+
+/**
+ * Reserve space in an LP builder so that data can be added without
+ * reallocation.
+ *
+ * @param builder   A pointer to the LP builder.
+ * @param num_col   The total number of columns expected.
+ * @param num_row   The total number of rows expected.
+ * @param num_nz    The total number of matrix entries expected with
+ *                  columns.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderReserve(void* builder, const HighsInt num_col,
+                                const HighsInt num_row, const HighsInt num_nz);
+
+/**
+ * Discard any data in an LP builder, and allocate the arrays of an LP
+ * with the given dimensions, returning pointers to them. The caller
+ * writes the LP data directly into these arrays, which are owned by
+ * the builder. When the LP is passed to a Highs instance by
+ * `Highs_passLpBuilder`, the arrays become those of its incumbent
+ * model without being copied.
+ *
+ * @param builder   A pointer to the LP builder.
+ * @param num_col   The number of columns.
+ * @param num_row   The number of rows.
+ * @param num_nz    The number of nonzeros in the constraint matrix.
+ * @param col_cost  Set to an array of length [num_col] for the column costs.
+ * @param col_lower Set to an array of length [num_col] for the column lower
+ *                  bounds.
+ * @param col_upper Set to an array of length [num_col] for the column upper
+ *                  bounds.
+ * @param row_lower Set to an array of length [num_row] for the row lower
+ *                  bounds.
+ * @param row_upper Set to an array of length [num_row] for the row upper
+ *                  bounds.
+ * @param a_start   Set to an array of length [num_col] for the column-wise
+ *                  starts of the constraint matrix.
+ * @param a_index   Set to an array of length [num_nz] for the row indices of
+ *                  the constraint matrix entries.
+ * @param a_value   Set to an array of length [num_nz] for the values of the
+ *                  constraint matrix entries.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderAllocate(void* builder, const HighsInt num_col,
+                                 const HighsInt num_row, const HighsInt num_nz,
+                                 double** col_cost, double** col_lower,
+                                 double** col_upper, double** row_lower,
+                                 double** row_upper, HighsInt** a_start,
+                                 HighsInt** a_index, double** a_value);
+
+/**
+ * Add columns to an LP builder, as for `Highs_addCols`. Row indices
+ * may refer to rows that are yet to be added.
+ *
+ * @param builder       A pointer to the LP builder.
+ * @param num_new_col   The number of new columns to add.
+ * @param costs         An array of size [num_new_col] with objective
+ *                      coefficients.
+ * @param lower         An array of size [num_new_col] with lower bounds.
+ * @param upper         An array of size [num_new_col] with upper bounds.
+ * @param num_new_nz    The number of new nonzeros in the constraint matrix.
+ * @param starts        An array of size [num_new_col] with the start index
+ *                      of each column in `index` and `value`.
+ * @param index         An array of size [num_new_nz] with row indices.
+ * @param value         An array of size [num_new_nz] with values.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderAddCols(void* builder, const HighsInt num_new_col,
+                                const double* costs, const double* lower,
+                                const double* upper, const HighsInt num_new_nz,
+                                const HighsInt* starts, const HighsInt* index,
+                                const double* value);
+
+/**
+ * Add rows to an LP builder, as for `Highs_addRows`. Column indices
+ * may refer to columns that are yet to be added.
+ *
+ * @param builder       A pointer to the LP builder.
+ * @param num_new_row   The number of new rows to add.
+ * @param lower         An array of size [num_new_row] with lower bounds.
+ * @param upper         An array of size [num_new_row] with upper bounds.
+ * @param num_new_nz    The number of new nonzeros in the constraint matrix.
+ * @param starts        An array of size [num_new_row] with the start index
+ *                      of each row in `index` and `value`.
+ * @param index         An array of size [num_new_nz] with column indices.
+ * @param value         An array of size [num_new_nz] with values.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderAddRows(void* builder, const HighsInt num_new_row,
+                                const double* lower, const double* upper,
+                                const HighsInt num_new_nz,
+                                const HighsInt* starts, const HighsInt* index,
+                                const double* value);
+
+/**
+ * Add constraint matrix entries to an LP builder as triplets.
+ *
+ * @param builder       A pointer to the LP builder.
+ * @param num_new_nz    The number of new entries.
+ * @param row           An array of size [num_new_nz] with row indices.
+ * @param col           An array of size [num_new_nz] with column indices.
+ * @param value         An array of size [num_new_nz] with values.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderAddEntries(void* builder, const HighsInt num_new_nz,
+                                   const HighsInt* row, const HighsInt* col,
+                                   const double* value);
+
+/**
+ * Set the integrality of a column in an LP builder.
+ *
+ * @param builder       A pointer to the LP builder.
+ * @param col           The index of the column.
+ * @param integrality   A `kHighsVarType` constant.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderSetIntegrality(void* builder, const HighsInt col,
+                                       const HighsInt integrality);
+
+/**
+ * Set the objective sense and offset of the LP in an LP builder.
+ *
+ * @param builder   A pointer to the LP builder.
+ * @param sense     The optimization sense as a `kHighsObjSense` constant.
+ * @param offset    The constant offset in the objective.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_lpBuilderSetObjective(void* builder, const HighsInt sense,
+                                     const double offset);
+
+/**
+ * Pass the LP in an LP builder to a Highs instance, leaving the
+ * builder empty.
+ *
+ * @param highs     A pointer to the Highs instance.
+ * @param builder   A pointer to the LP builder.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_passLpBuilder(void* highs, void* builder);
+
 /**
  * Pass the name of a row.
  *
@@ -14,6 +14,7 @@
 #include <cctype>
 
 #include "io/FilereaderEms.h"
+#include "io/FilereaderHbin.h"
 #include "io/FilereaderLp.h"
 #include "io/FilereaderMps.h"
 #include "io/HighsIO.h"
@@ -49,6 +50,10 @@ Filereader* Filereader::getFilereader(const HighsLogOptions& log_options,
                  filename.c_str());
     reader = NULL;
 #endif
+  } else if (extension == "zst") {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS build without zstd support. Cannot read .zst file.\n");
+    return NULL;
     //  } else if (extension == "zip") {
     // #ifdef ZLIB_FOUND
     //    extension = getFilenameExt(filename.substr(0, filename.size() - 4));
@@ -67,6 +72,8 @@ Filereader* Filereader::getFilereader(const HighsLogOptions& log_options,
     reader = new FilereaderLp();
   } else if (lower_case_extension.compare("ems") == 0) {
     reader = new FilereaderEms();
+  } else if (lower_case_extension.compare("hbin") == 0) {
+    reader = new FilereaderHbin();
   } else {
     reader = NULL;
   }
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <iomanip>
 
+#include "io/HighsInputFile.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLpUtils.h"
 #include "util/stringutil.h"
@@ -24,12 +25,11 @@
 FilereaderRetcode FilereaderEms::readModelFromFile(const HighsOptions& options,
                                                    const std::string filename,
                                                    HighsModel& model) {
-  std::ifstream f;
+  HighsInputFile f;
   HighsInt i;
 
   HighsLp& lp = model.lp_;
-  f.open(filename, std::ios::in);
-  if (f.is_open()) {
+  if (f.open(filename)) {
     std::string line;
     HighsInt numCol, numRow, AcountX, num_int;
     bool indices_from_one = false;
@@ -0,0 +1,346 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbin.cpp
+ * @brief
+ */
+
+#include "io/FilereaderHbin.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/types.h>
+#endif
+
+#include "lp_data/HConst.h"
+
+// Layout of a .hbin file, all values in native byte order
+//
+// char[8]   magic "HiGHSbin"
+// uint32_t  version, endianness marker, sizeof(HighsInt), flags
+// int64_t   num_col, num_row, num_nz
+// int32_t   sense, Hessian format
+// double    offset
+// int64_t   Hessian dim, Hessian num_nz
+//
+// followed by the arrays: col_cost, col_lower, col_upper, row_lower,
+// row_upper, a_matrix start/index/value (column-wise), then
+// integrality and the Hessian start/index/value if flagged, and
+// finally the names block: its size as uint64_t, then the objective
+// name and any column and row names, each terminated by '\0'
+const char kHbinMagic[8] = {'H', 'i', 'G', 'H', 'S', 'b', 'i', 'n'};
+const uint32_t kHbinEndianMarker = 0x01020304;
+const uint32_t kHbinHasIntegrality = 1;
+const uint32_t kHbinHasHessian = 2;
+const uint32_t kHbinHasColNames = 4;
+const uint32_t kHbinHasRowNames = 8;
+
+// Position in a file, in 64 bits, since long is 32 bits on Windows
+static int64_t fileTell(FILE* file) {
+#ifdef _WIN32
+  return _ftelli64(file);
+#else
+  return ftello(file);
+#endif
+}
+
+static int fileSeek(FILE* file, const int64_t offset, const int origin) {
+#ifdef _WIN32
+  return _fseeki64(file, offset, origin);
+#else
+  return fseeko(file, offset, origin);
+#endif
+}
+
+template <typename T>
+static bool writeArray(FILE* file, const T* data, const size_t count) {
+  return count == 0 || fwrite(data, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+static bool writeValue(FILE* file, const T value) {
+  return writeArray(file, &value, 1);
+}
+
+template <typename T>
+static bool readArray(FILE* file, const size_t count, std::vector<T>& data) {
+  data.resize(count);
+  return count == 0 || fread(data.data(), sizeof(T), count, file) == count;
+}
+
+template <typename T>
+static bool readValue(FILE* file, T& value) {
+  return fread(&value, sizeof(T), 1, file) == 1;
+}
+
+// Read integers written with width int_size into HighsInt, converting
+// only if the width differs from that of this build
+template <typename T>
+static bool readConvertIntArray(FILE* file, const size_t count,
+                                std::vector<HighsInt>& data) {
+  std::vector<T> buffer;
+  if (!readArray(file, count, buffer)) return false;
+  data.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    const int64_t value = buffer[i];
+    if (value > int64_t(kHighsIInf) || value < -int64_t(kHighsIInf))
+      return false;
+    data[i] = HighsInt(value);
+  }
+  return true;
+}
+
+static bool readIntArray(FILE* file, const uint32_t int_size,
+                         const size_t count, std::vector<HighsInt>& data) {
+  if (int_size == sizeof(HighsInt)) return readArray(file, count, data);
+  if (int_size == sizeof(int32_t))
+    return readConvertIntArray<int32_t>(file, count, data);
+  return readConvertIntArray<int64_t>(file, count, data);
+}
+
+// A compressed matrix read from a file is checked to have
+// non-decreasing starts and indices in [0, num_index), since the model
+// may be used without being assessed
+static bool validMatrixStructure(const std::vector<HighsInt>& start,
+                                 const std::vector<HighsInt>& index,
+                                 const HighsInt num_vec,
+                                 const HighsInt num_index) {
+  if (start[0] != 0 || start[num_vec] != HighsInt(index.size())) return false;
+  for (HighsInt iVec = 0; iVec < num_vec; iVec++)
+    if (start[iVec + 1] < start[iVec]) return false;
+  for (const HighsInt iIndex : index)
+    if (iIndex < 0 || iIndex >= num_index) return false;
+  return true;
+}
+
+static bool readNames(const size_t num_name,
+                      const std::vector<char>& block, size_t& pos,
+                      std::vector<std::string>& names) {
+  names.resize(num_name);
+  for (size_t i = 0; i < num_name; i++) {
+    const char* name = block.data() + pos;
+    const void* end = memchr(name, '\0', block.size() - pos);
+    if (end == nullptr) return false;
+    const size_t length = static_cast<const char*>(end) - name;
+    names[i].assign(name, length);
+    pos += length + 1;
+  }
+  return true;
+}
+
+FilereaderRetcode FilereaderHbin::readModelFromFile(
+    const HighsOptions& options, const std::string filename,
+    HighsModel& model) {
+  HighsLp& lp = model.lp_;
+  HighsHessian& hessian = model.hessian_;
+  const HighsLogOptions& log_options = options.log_options;
+
+  if (filename.size() > 3 &&
+      filename.compare(filename.size() - 3, 3, ".gz") == 0) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Compressed HBIN files are not supported\n");
+    return FilereaderRetcode::kNotImplemented;
+  }
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (file == nullptr) return FilereaderRetcode::kFileNotFound;
+  fileSeek(file, 0, SEEK_END);
+  const int64_t file_size = fileTell(file);
+  fileSeek(file, 0, SEEK_SET);
+
+  auto parserError = [&](const char* message) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HBIN file %s: %s\n", filename.c_str(), message);
+    fclose(file);
+    return FilereaderRetcode::kParserError;
+  };
+
+  char magic[8];
+  uint32_t version, endian, int_size, flags;
+  if (fread(magic, 1, 8, file) != 8 || memcmp(magic, kHbinMagic, 8) != 0)
+    return parserError("not a HiGHS binary model file");
+  if (!readValue(file, version) || !readValue(file, endian) ||
+      !readValue(file, int_size) || !readValue(file, flags))
+    return parserError("truncated header");
+  if (endian != kHbinEndianMarker)
+    return parserError("written with a different byte order");
+  if (version > kHbinVersion)
+    return parserError("written by a newer version of HiGHS");
+  if (int_size != sizeof(int32_t) && int_size != sizeof(int64_t))
+    return parserError("invalid integer width");
+
+  int64_t num_col, num_row, num_nz, hessian_dim, hessian_nz;
+  int32_t sense, hessian_format;
+  double offset;
+  if (!readValue(file, num_col) || !readValue(file, num_row) ||
+      !readValue(file, num_nz) || !readValue(file, sense) ||
+      !readValue(file, hessian_format) || !readValue(file, offset) ||
+      !readValue(file, hessian_dim) || !readValue(file, hessian_nz))
+    return parserError("truncated header");
+
+  // Check the dimensions against the file size before allocating
+  // anything, so that a corrupt header can't trigger huge allocations
+  const int64_t max_dim = file_size;
+  if (num_col < 0 || num_row < 0 || num_nz < 0 || hessian_dim < 0 ||
+      hessian_nz < 0 || num_col > max_dim || num_row > max_dim ||
+      num_nz > max_dim || hessian_dim > max_dim || hessian_nz > max_dim ||
+      num_col >= kHighsIInf || num_row >= kHighsIInf || num_nz >= kHighsIInf)
+    return parserError("invalid dimensions");
+  const bool has_hessian = flags & kHbinHasHessian;
+  if (has_hessian && hessian_dim != num_col)
+    return parserError("inconsistent Hessian dimension");
+  int64_t num_bytes = sizeof(double) * (3 * num_col + 2 * num_row + num_nz) +
+                      int_size * (num_col + 1 + num_nz);
+  if (flags & kHbinHasIntegrality) num_bytes += num_col;
+  if (has_hessian)
+    num_bytes += sizeof(double) * hessian_nz +
+                 int_size * (hessian_dim + 1 + hessian_nz);
+  if (fileTell(file) + num_bytes > file_size)
+    return parserError("file is truncated");
+
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.sense_ = sense == (int32_t)ObjSense::kMaximize ? ObjSense::kMaximize
+                                                      : ObjSense::kMinimize;
+  lp.offset_ = offset;
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  if (!readArray(file, num_col, lp.col_cost_) ||
+      !readArray(file, num_col, lp.col_lower_) ||
+      !readArray(file, num_col, lp.col_upper_) ||
+      !readArray(file, num_row, lp.row_lower_) ||
+      !readArray(file, num_row, lp.row_upper_) ||
+      !readIntArray(file, int_size, num_col + 1, lp.a_matrix_.start_) ||
+      !readIntArray(file, int_size, num_nz, lp.a_matrix_.index_) ||
+      !readArray(file, num_nz, lp.a_matrix_.value_))
+    return parserError("failed to read LP data");
+  if (!validMatrixStructure(lp.a_matrix_.start_, lp.a_matrix_.index_,
+                            num_col, num_row))
+    return parserError("inconsistent constraint matrix");
+  lp.setMatrixDimensions();
+
+  if (flags & kHbinHasIntegrality) {
+    static_assert(sizeof(HighsVarType) == 1,
+                  "HBIN files store integrality as single bytes");
+    if (!readArray(file, num_col, lp.integrality_))
+      return parserError("failed to read integrality");
+    for (const HighsVarType type : lp.integrality_)
+      if (uint8_t(type) > uint8_t(HighsVarType::kImplicitInteger))
+        return parserError("invalid integrality");
+  }
+
+  if (has_hessian) {
+    hessian.dim_ = hessian_dim;
+    hessian.format_ = hessian_format == (int32_t)HessianFormat::kSquare
+                          ? HessianFormat::kSquare
+                          : HessianFormat::kTriangular;
+    if (!readIntArray(file, int_size, hessian_dim + 1, hessian.start_) ||
+        !readIntArray(file, int_size, hessian_nz, hessian.index_) ||
+        !readArray(file, hessian_nz, hessian.value_))
+      return parserError("failed to read Hessian");
+    if (!validMatrixStructure(hessian.start_, hessian.index_, hessian_dim,
+                              hessian_dim))
+      return parserError("inconsistent Hessian");
+  }
+
+  uint64_t names_size;
+  if (!readValue(file, names_size) ||
+      names_size > uint64_t(file_size - fileTell(file)))
+    return parserError("failed to read names");
+  std::vector<char> block;
+  if (!readArray(file, names_size, block))
+    return parserError("failed to read names");
+  size_t pos = 0;
+  std::vector<std::string> objective_name;
+  if (!readNames(1, block, pos, objective_name) ||
+      ((flags & kHbinHasColNames) &&
+       !readNames(num_col, block, pos, lp.col_names_)) ||
+      ((flags & kHbinHasRowNames) &&
+       !readNames(num_row, block, pos, lp.row_names_)))
+    return parserError("failed to read names");
+  lp.objective_name_ = objective_name[0];
+  fclose(file);
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderHbin::writeModelToFile(const HighsOptions& options,
+                                             const std::string filename,
+                                             const HighsModel& model) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.a_matrix_.isColwise());
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt num_nz = lp.a_matrix_.numNz();
+  const bool has_hessian = hessian.dim_ > 0;
+  const HighsInt hessian_nz = has_hessian ? hessian.numNz() : 0;
+  uint32_t flags = 0;
+  if ((HighsInt)lp.integrality_.size() == num_col)
+    flags |= kHbinHasIntegrality;
+  if (has_hessian) flags |= kHbinHasHessian;
+  if ((HighsInt)lp.col_names_.size() == num_col) flags |= kHbinHasColNames;
+  if ((HighsInt)lp.row_names_.size() == num_row) flags |= kHbinHasRowNames;
+
+  bool ok = fwrite(kHbinMagic, 1, 8, file) == 8 &&
+            writeValue(file, kHbinVersion) &&
+            writeValue(file, kHbinEndianMarker) &&
+            writeValue(file, uint32_t(sizeof(HighsInt))) &&
+            writeValue(file, flags) && writeValue(file, int64_t(num_col)) &&
+            writeValue(file, int64_t(num_row)) &&
+            writeValue(file, int64_t(num_nz)) &&
+            writeValue(file, int32_t(lp.sense_)) &&
+            writeValue(file, int32_t(hessian.format_)) &&
+            writeValue(file, lp.offset_) &&
+            writeValue(file, int64_t(has_hessian ? hessian.dim_ : 0)) &&
+            writeValue(file, int64_t(hessian_nz));
+
+  ok = ok && writeArray(file, lp.col_cost_.data(), num_col) &&
+       writeArray(file, lp.col_lower_.data(), num_col) &&
+       writeArray(file, lp.col_upper_.data(), num_col) &&
+       writeArray(file, lp.row_lower_.data(), num_row) &&
+       writeArray(file, lp.row_upper_.data(), num_row) &&
+       writeArray(file, lp.a_matrix_.start_.data(), num_col + 1) &&
+       writeArray(file, lp.a_matrix_.index_.data(), num_nz) &&
+       writeArray(file, lp.a_matrix_.value_.data(), num_nz);
+  if (flags & kHbinHasIntegrality)
+    ok = ok && writeArray(file, lp.integrality_.data(), num_col);
+  if (has_hessian)
+    ok = ok && writeArray(file, hessian.start_.data(), hessian.dim_ + 1) &&
+         writeArray(file, hessian.index_.data(), hessian_nz) &&
+         writeArray(file, hessian.value_.data(), hessian_nz);
+
+  std::vector<char> block(lp.objective_name_.begin(),
+                          lp.objective_name_.end());
+  block.push_back('\0');
+  auto addNames = [&](const std::vector<std::string>& names) {
+    for (const std::string& name : names) {
+      block.insert(block.end(), name.begin(), name.end());
+      block.push_back('\0');
+    }
+  };
+  if (flags & kHbinHasColNames) addNames(lp.col_names_);
+  if (flags & kHbinHasRowNames) addNames(lp.row_names_);
+  ok = ok && writeValue(file, uint64_t(block.size())) &&
+       writeArray(file, block.data(), block.size());
+
+  if (fclose(file) != 0) ok = false;
+  if (!ok) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Failed to write HBIN file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,39 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbin.h
+ * @brief Native binary model format
+ *
+ * A .hbin file holds a versioned header followed by the arrays of the
+ * HighsModel in the order in which they are stored in memory, so that
+ * reading a model is a sequence of bulk reads into its vectors, with
+ * no parsing. Integers are stored with the width of HighsInt in the
+ * writing build, and converted on reading if necessary.
+ */
+
+#ifndef IO_FILEREADER_HBIN_H_
+#define IO_FILEREADER_HBIN_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+
+const uint32_t kHbinVersion = 1;
+
+class FilereaderHbin : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+};
+
+#endif
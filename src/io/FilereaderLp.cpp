@@ -17,9 +17,9 @@
 #include <cstdarg>
 #include <cstdio>
 #include <exception>
-#include <map>
 
 #include "filereaderlp/reader.hpp"
+#include "io/HighsInputFile.h"
 #include "lp_data/HighsLpUtils.h"
 
 const bool original_double_format = false;
@@ -31,7 +31,11 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
   HighsLp& lp = model.lp_;
   HighsHessian& hessian = model.hessian_;
   try {
-    Model m = readinstance(filename);
+    // The file is opened here so that the LP reader gets the same
+    // handling of compressed files as the other readers
+    HighsInputFile file;
+    if (!file.open(filename)) return FilereaderRetcode::kFileNotFound;
+    Model m = readinstance(file);
 
     if (!m.soss.empty()) {
       highsLogUser(options.log_options, HighsLogType::kError,
@@ -39,19 +43,20 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
       return FilereaderRetcode::kParserError;
     }
 
-    // build variable index and gather variable information
-    std::map<std::string, unsigned int> varindex;
-
+    // gather variable information: terms refer to variables by their
+    // index, so no name lookup is required
     lp.num_col_ = m.variables.size();
     lp.num_row_ = m.constraints.size();
     lp.row_names_.resize(m.constraints.size());
     lp.integrality_.assign(lp.num_col_, HighsVarType::kContinuous);
+    lp.col_lower_.resize(lp.num_col_);
+    lp.col_upper_.resize(lp.num_col_);
+    lp.col_names_.resize(lp.num_col_);
     HighsInt num_continuous = 0;
     for (size_t i = 0; i < m.variables.size(); i++) {
-      varindex[m.variables[i]->name] = i;
-      lp.col_lower_.push_back(m.variables[i]->lowerbound);
-      lp.col_upper_.push_back(m.variables[i]->upperbound);
-      lp.col_names_.push_back(m.variables[i]->name);
+      lp.col_lower_[i] = m.variables[i]->lowerbound;
+      lp.col_upper_[i] = m.variables[i]->upperbound;
+      lp.col_names_[i] = m.variables[i]->name;
       if (m.variables[i]->type == VariableType::BINARY ||
           m.variables[i]->type == VariableType::GENERAL) {
         lp.integrality_[i] = HighsVarType::kInteger;
@@ -68,86 +73,72 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
     if (static_cast<size_t>(num_continuous) == m.variables.size())
       lp.integrality_.clear();
     // get objective
-    lp.objective_name_ = m.objective->name;
-    // ToDo: Fix m.objective->offset and then use it here
+    lp.objective_name_ = m.objective.name;
+    // ToDo: Fix m.objective.offset and then use it here
     //
-    lp.offset_ = m.objective->offset;
+    lp.offset_ = m.objective.offset;
     lp.col_cost_.resize(lp.num_col_, 0.0);
-    for (size_t i = 0; i < m.objective->linterms.size(); i++) {
-      std::shared_ptr<LinTerm> lt = m.objective->linterms[i];
-      lp.col_cost_[varindex[lt->var->name]] = lt->coef;
-    }
-
-    std::map<std::shared_ptr<Variable>, std::vector<std::shared_ptr<Variable>>>
-        mat;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> mat2;
-    for (std::shared_ptr<QuadTerm> qt : m.objective->quadterms) {
-      if (qt->var1 != qt->var2) {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef / 2);
-        mat[qt->var2].push_back(qt->var1);
-        mat2[qt->var2].push_back(qt->coef / 2);
-      } else {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef);
-      }
+    for (const LinTerm& lt : m.objective.linterms)
+      lp.col_cost_[lt.var] = lt.coef;
+
+    // Set up the (square) Hessian directly in column-wise form by
+    // counting the nonzero entries in each column, and then placing
+    // them in the order in which the terms were read
+    std::vector<HighsInt> count(lp.num_col_ + 1, 0);
+    HighsInt qnnz = 0;
+    for (const QuadTerm& qt : m.objective.quadterms) {
+      if (!qt.coef) continue;
+      count[qt.var1]++;
+      if (qt.var1 != qt.var2) count[qt.var2]++;
     }
-
-    // Determine whether there is a Hessian to set up by counting its
-    // nonzero entries
-    unsigned int qnnz = 0;
-    for (std::shared_ptr<Variable> var : m.variables)
-      for (size_t i = 0; i < mat[var].size(); i++)
-        if (mat2[var][i]) qnnz++;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) qnnz += count[iCol];
     if (qnnz) {
-      hessian.dim_ = m.variables.size();
-      qnnz = 0;
-      // model_.hessian_ is initialised with start_[0] for fictitious
-      // column 0, so have to clear this before pushing back start
-      hessian.start_.clear();
-      assert((int)hessian.start_.size() == 0);
-      for (std::shared_ptr<Variable> var : m.variables) {
-        hessian.start_.push_back(qnnz);
-        for (size_t i = 0; i < mat[var].size(); i++) {
-          double value = mat2[var][i];
-          if (value) {
-            hessian.index_.push_back(varindex[mat[var][i]->name]);
-            hessian.value_.push_back(value);
-            qnnz++;
-          }
+      hessian.dim_ = lp.num_col_;
+      hessian.start_.resize(lp.num_col_ + 1);
+      hessian.index_.resize(qnnz);
+      hessian.value_.resize(qnnz);
+      hessian.start_[0] = 0;
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+        hessian.start_[iCol + 1] = hessian.start_[iCol] + count[iCol];
+        count[iCol] = hessian.start_[iCol];
+      }
+      for (const QuadTerm& qt : m.objective.quadterms) {
+        if (!qt.coef) continue;
+        if (qt.var1 != qt.var2) {
+          const double value = qt.coef / 2;
+          HighsInt iEl = count[qt.var1]++;
+          hessian.index_[iEl] = qt.var2;
+          hessian.value_[iEl] = value;
+          iEl = count[qt.var2]++;
+          hessian.index_[iEl] = qt.var1;
+          hessian.value_[iEl] = value;
+        } else {
+          const HighsInt iEl = count[qt.var1]++;
+          hessian.index_[iEl] = qt.var2;
+          hessian.value_[iEl] = qt.coef;
         }
       }
-      hessian.start_.push_back(qnnz);
       hessian.format_ = HessianFormat::kSquare;
     } else {
       assert(hessian.dim_ == 0 && hessian.start_[0] == 0);
     }
 
-    // handle constraints
-    std::map<std::shared_ptr<Variable>, std::vector<unsigned int>>
-        consofvarmap_index;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> consofvarmap_value;
+    // handle constraints, counting the nonzeros in each column
+    lp.row_lower_.resize(lp.num_row_);
+    lp.row_upper_.resize(lp.num_row_);
+    count.assign(lp.num_col_ + 1, 0);
     for (size_t i = 0; i < m.constraints.size(); i++) {
-      std::shared_ptr<Constraint> con = m.constraints[i];
-      lp.row_names_[i] = con->expr->name;
-      for (size_t j = 0; j < con->expr->linterms.size(); j++) {
-        std::shared_ptr<LinTerm> lt = con->expr->linterms[j];
-        if (consofvarmap_index.count(lt->var) == 0) {
-          consofvarmap_index[lt->var] = std::vector<unsigned int>();
-          consofvarmap_value[lt->var] = std::vector<double>();
-        }
-        consofvarmap_index[lt->var].push_back(i);
-        consofvarmap_value[lt->var].push_back(lt->coef);
-      }
-
-      lp.row_lower_.push_back(con->lowerbound);
-      lp.row_upper_.push_back(con->upperbound);
-
-      if (!con->expr->quadterms.empty()) {
+      const Constraint& con = m.constraints[i];
+      if (!con.expr.quadterms.empty()) {
         highsLogUser(options.log_options, HighsLogType::kError,
                      "Quadratic constraints not supported by HiGHS\n");
         return FilereaderRetcode::kParserError;
       }
+      lp.row_names_[i] = con.expr.name;
+      lp.row_lower_[i] = con.lowerbound;
+      lp.row_upper_[i] = con.upperbound;
+      for (const LinTerm& lt : con.expr.linterms)
+        if (lt.coef) count[lt.var]++;
     }
 
     // Check for empty row names, giving them a special name if possible
@@ -175,24 +166,25 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
                    "with same prefix: row names cleared\n");
     }
 
-    HighsInt nz = 0;
-    // lp.a_matrix_ is initialised with start_[0] for fictitious
-    // column 0, so have to clear this before pushing back start
-    lp.a_matrix_.start_.clear();
-    assert((int)lp.a_matrix_.start_.size() == 0);
-    for (HighsInt i = 0; i < lp.num_col_; i++) {
-      std::shared_ptr<Variable> var = m.variables[i];
-      lp.a_matrix_.start_.push_back(nz);
-      for (size_t j = 0; j < consofvarmap_index[var].size(); j++) {
-        double value = consofvarmap_value[var][j];
-        if (value) {
-          lp.a_matrix_.index_.push_back(consofvarmap_index[var][j]);
-          lp.a_matrix_.value_.push_back(value);
-          nz++;
-        }
+    // Form the column-wise constraint matrix directly from the
+    // counts, placing the entries of each column in row order
+    std::vector<HighsInt>& start = lp.a_matrix_.start_;
+    start.resize(lp.num_col_ + 1);
+    start[0] = 0;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      start[iCol + 1] = start[iCol] + count[iCol];
+      count[iCol] = start[iCol];
+    }
+    lp.a_matrix_.index_.resize(start[lp.num_col_]);
+    lp.a_matrix_.value_.resize(start[lp.num_col_]);
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+      for (const LinTerm& lt : m.constraints[iRow].expr.linterms) {
+        if (!lt.coef) continue;
+        const HighsInt iEl = count[lt.var]++;
+        lp.a_matrix_.index_[iEl] = iRow;
+        lp.a_matrix_.value_[iEl] = lt.coef;
       }
     }
-    lp.a_matrix_.start_.push_back(nz);
     lp.a_matrix_.format_ = MatrixFormat::kColwise;
     lp.sense_ = m.sense == ObjectiveSense::MIN ? ObjSense::kMinimize
                                                : ObjSense::kMaximize;
@@ -219,19 +211,27 @@ void FilereaderLp::writeToFile(FILE* file, const char* format, ...) {
   char stringbuffer[LP_MAX_LINE_LENGTH + 1];
   HighsInt tokenlength =
       vsnprintf(stringbuffer, sizeof stringbuffer, format, argptr);
+  va_end(argptr);
   if (this->linelength + tokenlength >= LP_MAX_LINE_LENGTH) {
-    fprintf(file, "\n");
-    fprintf(file, "%s", stringbuffer);
+    this->write_buffer += '\n';
+    this->write_buffer += stringbuffer;
     this->linelength = tokenlength;
   } else {
-    fprintf(file, "%s", stringbuffer);
+    this->write_buffer += stringbuffer;
     this->linelength += tokenlength;
   }
 }
 
 void FilereaderLp::writeToFileLineend(FILE* file) {
-  fprintf(file, "\n");
+  this->write_buffer += '\n';
   this->linelength = 0;
+  if (this->write_buffer.size() >= LP_WRITE_BUFFER_SIZE)
+    this->writeToFileFlush(file);
+}
+
+void FilereaderLp::writeToFileFlush(FILE* file) {
+  fwrite(this->write_buffer.data(), 1, this->write_buffer.size(), file);
+  this->write_buffer.clear();
 }
 
 void FilereaderLp::writeToFileValue(FILE* file, const double value,
@@ -252,7 +252,7 @@ void FilereaderLp::writeToFileVar(FILE* file, const HighsInt var_index) {
   this->writeToFile(file, " x%" HIGHSINT_FORMAT, var_index + 1);
 }
 
-void FilereaderLp::writeToFileVar(FILE* file, const std::string var_name) {
+void FilereaderLp::writeToFileVar(FILE* file, const std::string& var_name) {
   this->writeToFile(file, " %s", var_name.c_str());
 }
 
@@ -261,8 +261,8 @@ void FilereaderLp::writeToFileCon(FILE* file, const HighsInt con_index) {
 }
 
 void FilereaderLp::writeToFileMatrixRow(FILE* file, const HighsInt iRow,
-                                        const HighsSparseMatrix ar_matrix,
-                                        const std::vector<string> col_names) {
+                                        const HighsSparseMatrix& ar_matrix,
+                                        const std::vector<string>& col_names) {
   assert(ar_matrix.isRowwise());
   const bool has_col_names = allow_model_names && col_names.size() > 0;
 
@@ -294,6 +294,15 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
       allow_model_names &&
       lp.row_names_.size() == static_cast<size_t>(lp.num_row_);
   FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  // Text is accumulated in write_buffer and written in large blocks
+  this->linelength = 0;
+  this->write_buffer.clear();
+  this->write_buffer.reserve(LP_WRITE_BUFFER_SIZE + BUFFERSIZE);
 
   // write comment at the start of the file
   this->writeToFile(file, "\\ %s", LP_COMMENT_FILESTART);
@@ -503,6 +512,7 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
   // write end
   this->writeToFile(file, "end");
   this->writeToFileLineend(file);
+  this->writeToFileFlush(file);
 
   fclose(file);
   return HighsStatus::kOk;
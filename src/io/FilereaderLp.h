@@ -23,6 +23,7 @@
 #define BUFFERSIZE 561
 #define LP_MAX_LINE_LENGTH 560
 #define LP_MAX_NAME_LENGTH 255
+#define LP_WRITE_BUFFER_SIZE (1 << 20)
 
 #define LP_COMMENT_FILESTART ("File written by HiGHS .lp file handler")
 
@@ -39,16 +40,18 @@ class FilereaderLp : public Filereader {
  private:
   // functions to write files
   HighsInt linelength;
+  std::string write_buffer;
   void writeToFile(FILE* file, const char* format, ...);
   void writeToFileLineend(FILE* file);
+  void writeToFileFlush(FILE* file);
   void writeToFileValue(FILE* file, const double value,
                         const bool force_plus = true);
   void writeToFileVar(FILE* file, const HighsInt var_index);
-  void writeToFileVar(FILE* file, const std::string var_name);
+  void writeToFileVar(FILE* file, const std::string& var_name);
   void writeToFileCon(FILE* file, const HighsInt con_index);
   void writeToFileMatrixRow(FILE* file, const HighsInt iRow,
-                            const HighsSparseMatrix ar_matrix,
-                            const std::vector<string> col_names);
+                            const HighsSparseMatrix& ar_matrix,
+                            const std::vector<string>& col_names);
 };
 
 #endif
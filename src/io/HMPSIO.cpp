@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstdio>
 
+#include "io/HighsInputFile.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsModelUtils.h"
@@ -23,10 +24,6 @@
 #include "util/HighsUtils.h"
 #include "util/stringutil.h"
 
-#ifdef ZLIB_FOUND
-#include "zstr/zstr.hpp"
-#endif
-
 using std::map;
 
 //
@@ -58,19 +55,8 @@ FilereaderRetcode readMps(
   Astart.clear();
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
-#ifdef ZLIB_FOUND
-  zstr::ifstream file;
-  try {
-    file.open(filename, std::ios::in);
-  } catch (const strict_fstream::Exception& e) {
-    highsLogDev(log_options, HighsLogType::kInfo, e.what());
-    return FilereaderRetcode::kFileNotFound;
-  }
-#else
-  std::ifstream file;
-  file.open(filename, std::ios::in);
-#endif
-  if (!file.is_open()) {
+  HighsInputFile file;
+  if (!file.open(filename)) {
     highsLogDev(log_options, HighsLogType::kInfo,
                 "readMPS: Not opened file OK\n");
     return FilereaderRetcode::kFileNotFound;
@@ -759,19 +745,26 @@ HighsStatus writeMps(
   if (sense == ObjSense::kMaximize) fprintf(file, "OBJSENSE\n  MAX\n");
   fprintf(file, "ROWS\n");
   fprintf(file, " N  %-8s\n", objective_name.c_str());
-  for (HighsInt r_n = 0; r_n < num_row; r_n++) {
-    if (r_ty[r_n] == MPS_ROW_TY_E) {
-      fprintf(file, " E  %-8s\n", row_names[r_n].c_str());
-    } else if (r_ty[r_n] == MPS_ROW_TY_G) {
-      fprintf(file, " G  %-8s\n", row_names[r_n].c_str());
-    } else if (r_ty[r_n] == MPS_ROW_TY_L) {
-      fprintf(file, " L  %-8s\n", row_names[r_n].c_str());
-    } else {
-      fprintf(file, " N  %-8s\n", row_names[r_n].c_str());
-    }
-  }
+  // The ROWS and COLUMNS sections are the bulk of the file, so are
+  // formatted in chunks that are written as large blocks
+  highsWriteChunked(
+      file, num_row, [&](HighsInt from, HighsInt to, std::string& buffer) {
+        for (HighsInt r_n = from; r_n < to; r_n++) {
+          const char* type = r_ty[r_n] == MPS_ROW_TY_E   ? "E"
+                             : r_ty[r_n] == MPS_ROW_TY_G ? "G"
+                             : r_ty[r_n] == MPS_ROW_TY_L ? "L"
+                                                         : "N";
+          highsAppendFormat(buffer, " %s  %-8s\n", type,
+                            row_names[r_n].c_str());
+        }
+      });
+  // Determine the integer section marker, if any, to be written
+  // before each column: positive for INTORG and negative for INTEND,
+  // with magnitude one more than the marker number
   bool integerFg = false;
   HighsInt nIntegerMk = 0;
+  vector<HighsInt> marker;
+  if (have_int) marker.assign(num_col, 0);
   fprintf(file, "COLUMNS\n");
   const bool write_no_cost_zero_columns = true;
   for (HighsInt c_n = 0; c_n < num_col; c_n++) {
@@ -780,42 +773,56 @@ HighsStatus writeMps(
     if (no_cost_zero_column) {
       // Possibly skip this column as it's zero and has no cost
       num_no_cost_zero_columns++;
-      if (write_no_cost_zero_columns) {
-        // Give the column a presence by writing out a zero cost
-        fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-                objective_name.c_str(), 0.0);
-      }
       continue;
     }
     if (have_int) {
       if (integrality[c_n] == HighsVarType::kInteger && !integerFg) {
         // Start an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTORG'\n",
-                nIntegerMk++);
+        marker[c_n] = ++nIntegerMk;
         integerFg = true;
       } else if (integrality[c_n] != HighsVarType::kInteger && integerFg) {
         // End an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTEND'\n",
-                nIntegerMk++);
+        marker[c_n] = -(++nIntegerMk);
         integerFg = false;
       }
     }
-    if (col_cost[c_n] != 0) {
-      double v = use_sense * col_cost[c_n];
-      fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-              objective_name.c_str(), v);
-    }
-    for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1]; el_n++) {
-      double v = a_value[el_n];
-      HighsInt r_n = a_index[el_n];
-      fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-              row_names[r_n].c_str(), v);
-    }
   }
+  highsWriteChunked(
+      file, num_col, [&](HighsInt from, HighsInt to, std::string& buffer) {
+        for (HighsInt c_n = from; c_n < to; c_n++) {
+          const bool no_cost_zero_column =
+              !col_cost[c_n] && a_start[c_n] == a_start[c_n + 1];
+          if (no_cost_zero_column) {
+            if (write_no_cost_zero_columns) {
+              // Give the column a presence by writing out a zero cost
+              highsAppendFormat(buffer, "    %-8s  %-8s  %.10g\n",
+                                col_names[c_n].c_str(),
+                                objective_name.c_str(), 0.0);
+            }
+            continue;
+          }
+          if (have_int && marker[c_n])
+            highsAppendFormat(buffer,
+                              "    MARK%04" HIGHSINT_FORMAT
+                              "  'MARKER'                 '%s'\n",
+                              std::abs(marker[c_n]) - 1,
+                              marker[c_n] > 0 ? "INTORG" : "INTEND");
+          if (col_cost[c_n] != 0) {
+            double v = use_sense * col_cost[c_n];
+            highsAppendFormat(buffer, "    %-8s  %-8s  %.10g\n",
+                              col_names[c_n].c_str(), objective_name.c_str(),
+                              v);
+          }
+          for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1];
+               el_n++) {
+            double v = a_value[el_n];
+            HighsInt r_n = a_index[el_n];
+            highsAppendFormat(buffer, "    %-8s  %-8s  %.10g\n",
+                              col_names[c_n].c_str(), row_names[r_n].c_str(),
+                              v);
+          }
+        }
+      });
   // End any integer section
   if (integerFg)
     fprintf(file,
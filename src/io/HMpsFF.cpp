@@ -11,11 +11,9 @@
 
 #include "io/HMpsFF.h"
 
+#include "io/HighsInputFile.h"
 #include "lp_data/HighsModelUtils.h"
-
-#ifdef ZLIB_FOUND
-#include "zstr/zstr.hpp"
-#endif
+#include "parallel/HighsParallel.h"
 
 namespace free_format_parser {
 
@@ -53,7 +51,7 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
   // not valid. Report this for the first instance, and clear the row
   // (column) names array.
   //
-  // Note that rowname2idx and colname2idx will return the index
+  // Note that getRowIdx and getColIdx will return the index
   // corresponding to the first occurrence of the name, so values for
   // rows in the COLUMNS, RHS and RANGES sections, and columns in the
   // BOUNDS and other sections can only be defined for the first
@@ -216,19 +214,8 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
 
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
-#ifdef ZLIB_FOUND
-  zstr::ifstream f;
-  try {
-    f.open(filename.c_str(), std::ios::in);
-  } catch (const strict_fstream::Exception& e) {
-    highsLogDev(log_options, HighsLogType::kInfo, e.what());
-    return FreeFormatParserReturnCode::kFileNotFound;
-  }
-#else
-  std::ifstream f;
-  f.open(filename.c_str(), std::ios::in);
-#endif
-  if (f.is_open()) {
+  HighsInputFile f;
+  if (f.open(filename)) {
     start_time = getWallTime();
     num_row = 0;
     num_col = 0;
@@ -428,15 +415,37 @@ HMpsFF::Parsekey HMpsFF::checkFirstWord(std::string& strline, size_t& start,
     return HMpsFF::Parsekey::kNone;
 }
 
+HighsInt HMpsFF::getRowIdx(const std::string& rowname) const {
+  HighsInt rowidx = row_name_hash.find(row_names, rowname);
+  if (rowidx >= 0) return rowidx;
+  HighsInt other = other_row_name_hash.find(other_row_names, rowname);
+  if (other >= 0) return other_row_idx[other];
+  return kNoRowIdx;
+}
+
+bool HMpsFF::addRowName(const std::string& rowname, const HighsInt rowidx) {
+  // Only the first occurrence of a name is indexed
+  if (getRowIdx(rowname) != kNoRowIdx) return false;
+  if (rowidx >= 0) {
+    assert(rowidx == HighsInt(row_names.size()) - 1);
+    row_name_hash.insert(row_names, rowidx);
+  } else {
+    other_row_names.push_back(rowname);
+    other_row_idx.push_back(rowidx);
+    other_row_name_hash.insert(other_row_names, other_row_names.size() - 1);
+  }
+  return true;
+}
+
 HighsInt HMpsFF::getColIdx(const std::string& colname, const bool add_if_new) {
   // look up column name
-  auto mit = colname2idx.find(colname);
-  if (mit != colname2idx.end()) return mit->second;
+  HighsInt colidx = col_name_hash.find(col_names, colname);
+  if (colidx >= 0) return colidx;
 
   if (!add_if_new) return -1;
   // add new continuous column with default bounds
-  colname2idx.emplace(colname, num_col++);
   col_names.push_back(colname);
+  col_name_hash.insert(col_names, num_col++);
   col_integrality.push_back(HighsVarType::kContinuous);
   col_binary.push_back(false);
   col_lower.push_back(0.0);
@@ -553,7 +562,7 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
       if (!hasobj) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "No objective row found\n");
-        rowname2idx.emplace("artificial_empty_objective", -1);
+        addRowName("artificial_empty_objective", -1);
       };
       return key;
     }
@@ -602,31 +611,24 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
 
     // Do not add to matrix if row is free.
     if (isFreeRow) {
-      rowname2idx.emplace(rowname, -2);
+      addRowName(rowname, -2);
       continue;
     }
 
-    // so in rowname2idx -1 is the objective, -2 is all the free rows
-    auto ret = rowname2idx.emplace(rowname, isobj ? (-1) : (num_row++));
-    // ret is a pair consisting of an iterator to the inserted
-    // element (or the already-existing element if no insertion
-    // happened) and a bool denoting whether the insertion took place
-
     // Else is enough here because all free rows are ignored.
     if (!isobj)
       row_names.push_back(rowname);
     else
       objective_name = rowname;
 
-    if (!ret.second) {
+    // so the index of the objective is -1, and -2 is all the free rows
+    if (!addRowName(rowname, isobj ? (-1) : (num_row++))) {
       // Duplicate row name
       if (!has_duplicate_row_name_) {
         // This is the first so record it
         has_duplicate_row_name_ = true;
-        auto mit = rowname2idx.find(rowname);
-        assert(mit != rowname2idx.end());
         duplicate_row_name_ = rowname;
-        duplicate_row_name_index0_ = mit->second;
+        duplicate_row_name_index0_ = getRowIdx(rowname);
         duplicate_row_name_index1_ = num_row - 1;
       }
     }
@@ -642,11 +644,52 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
   return HMpsFF::Parsekey::kFail;
 }
 
+void HMpsFF::tokeniseColsLine(std::string& strline, ColsLine& line) const {
+  // the line is trimmed and does not start with a keyword, so the column
+  // name is its first word
+  size_t end = first_word_end(strline, 0);
+  line.col_name = strline.substr(0, end);
+  line.num_entry = 0;
+
+  // check for integrality marker
+  std::string marker = first_word(strline, end);
+  size_t end_marker = first_word_end(strline, end);
+  line.end_marker = end_marker;
+  line.is_marker = marker == "'MARKER'";
+  if (line.is_marker) {
+    line.entry[0].row_name = first_word(strline, end_marker);
+    return;
+  }
+
+  // here marker is the row name and end marks its end
+  std::string word = first_word(strline, end_marker);
+  end = first_word_end(strline, end_marker);
+  line.has_coefficient = word != "";
+
+  for (;;) {
+    ColsEntry& entry = line.entry[line.num_entry++];
+    entry.row_idx = getRowIdx(marker);
+    entry.row_found = entry.row_idx != kNoRowIdx;
+    if (entry.row_found) entry.value = strToDouble(word);
+    entry.row_name = std::move(marker);
+
+    if (line.num_entry == 2 || !line.has_coefficient || is_end(strline, end))
+      break;
+
+    // parse second coefficient
+    marker = first_word(strline, end);
+    end_marker = first_word_end(strline, end);
+    end_marker++;
+    word = first_word(strline, end_marker);
+    end = first_word_end(strline, end_marker);
+    assert(is_end(strline, end));
+  }
+}
+
 typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
                                             std::istream& file) {
   std::string colname = "";
   std::string strline, word;
-  HighsInt rowidx;
   size_t start, end;
   bool integral_cols = false;
   assert(num_col == 0);
@@ -658,95 +701,132 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
   col_value.assign(num_row, 0);
   col_index.resize(num_row);
 
-  auto parseName = [&rowidx, this](std::string name) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+  auto addEntry = [&](const ColsEntry& entry) {
+    const HighsInt rowidx = entry.row_idx;
+    if (rowidx >= 0) {
+      if (col_value[rowidx]) {
+        // Ignore duplicate entry
+        highsLogUser(log_options, HighsLogType::kWarning,
+                     "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                     colname.c_str(), entry.row_name.c_str());
+      } else {
+        col_value[rowidx] = entry.value;
+        col_index[col_count++] = rowidx;
+        num_nz++;
+      }
+    } else if (rowidx == -1) {
+      // Ignore duplicate entry
+      if (col_cost) {
+        highsLogUser(log_options, HighsLogType::kWarning,
+                     "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                     colname.c_str(), objective_name.c_str());
+      } else {
+        col_cost = entry.value;
+      }
+    } else
+      assert(-2 == rowidx);
+  };
 
-    if (rowidx >= 0)
-      this->num_nz++;
-    else
-      assert(-1 == rowidx || -2 == rowidx);
+  auto recordColumn = [&]() {
+    if (col_cost) {
+      coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
+      col_cost = 0;
+    }
+    for (HighsInt iEl = 0; iEl < col_count; iEl++) {
+      const HighsInt iRow = col_index[iEl];
+      assert(col_value[iRow]);
+      entries.push_back(std::make_tuple(num_col - 1, iRow, col_value[iRow]));
+      col_value[iRow] = 0;
+    }
+    col_count = 0;
   };
 
-  while (getline(file, strline)) {
+  // The section is read in batches of lines. Tokenising the lines of a
+  // batch, looking up their row names and converting their values does
+  // not depend on the parser state, so it is done in parallel when the
+  // global scheduler is running
+  const HighsInt kBatchSize = 16384;
+  const HighsInt kGrainSize = 256;
+  std::vector<std::string> batch;
+  std::vector<ColsLine> lines;
+  batch.reserve(kBatchSize);
+  const bool parallel = HighsTaskExecutor::isInitialized() &&
+                        highs::parallel::num_threads() > 1;
+
+  HMpsFF::Parsekey key = Parsekey::kNone;
+  bool end_of_file = false;
+  while (key == Parsekey::kNone && !end_of_file) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
 
-    if (kAnyFirstNonBlankAsStarImpliesComment) {
-      trim(strline);
-      if (strline.size() == 0 || strline[0] == '*') continue;
-    } else {
-      if (strline.size() > 0) {
-        // Just look for comment character in column 1
-        if (strline[0] == '*') continue;
+    batch.clear();
+    while ((HighsInt)batch.size() < kBatchSize) {
+      if (!getline(file, strline)) {
+        end_of_file = true;
+        break;
       }
-      trim(strline);
-      if (strline.size() == 0) continue;
-    }
-
-    HMpsFF::Parsekey key = checkFirstWord(strline, start, end, word);
-
-    // start of new section?
-    if (key != Parsekey::kNone) {
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
+      if (kAnyFirstNonBlankAsStarImpliesComment) {
+        trim(strline);
+        if (strline.size() == 0 || strline[0] == '*') continue;
+      } else {
+        if (strline.size() > 0) {
+          // Just look for comment character in column 1
+          if (strline[0] == '*') continue;
         }
-        col_count = 0;
+        trim(strline);
+        if (strline.size() == 0) continue;
       }
 
-      highsLogDev(log_options, HighsLogType::kInfo,
-                  "readMPS: Read COLUMNS OK\n");
-      return key;
-    }
+      // start of new section?
+      key = checkFirstWord(strline, start, end, word);
+      if (key != Parsekey::kNone) break;
 
-    // check for integrality marker
-    std::string marker = first_word(strline, end);
-    size_t end_marker = first_word_end(strline, end);
+      batch.push_back(std::move(strline));
+    }
 
-    if (marker == "'MARKER'") {
-      marker = first_word(strline, end_marker);
+    const HighsInt num_line = batch.size();
+    if ((HighsInt)lines.size() < num_line) lines.resize(num_line);
+    auto tokenise = [&](HighsInt first, HighsInt last) {
+      for (HighsInt i = first; i < last; ++i)
+        tokeniseColsLine(batch[i], lines[i]);
+    };
+    if (parallel && num_line > kGrainSize)
+      highs::parallel::for_each(0, num_line, tokenise, kGrainSize);
+    else
+      tokenise(0, num_line);
+
+    for (HighsInt i = 0; i < num_line; ++i) {
+      const ColsLine& line = lines[i];
+      if (line.is_marker) {
+        const std::string& marker = line.entry[0].row_name;
+        if ((integral_cols && marker != "'INTEND'") ||
+            (!integral_cols && marker != "'INTORG'")) {
+          highsLogUser(
+              log_options, HighsLogType::kError,
+              "Integrality marker error in COLUMNS section of MPS file\n");
+          return Parsekey::kFail;
+        }
+        integral_cols = !integral_cols;
 
-      if ((integral_cols && marker != "'INTEND'") ||
-          (!integral_cols && marker != "'INTORG'")) {
-        highsLogUser(
-            log_options, HighsLogType::kError,
-            "Integrality marker error in COLUMNS section of MPS file\n");
-        return Parsekey::kFail;
+        continue;
       }
-      integral_cols = !integral_cols;
-
-      continue;
-    }
-    // Detect whether the file is in fixed format with spaces in
-    // names, even if there are no known examples!
-    //
-    // end_marker should be the end index of the row name:
-    //
-    // If the names are at least 8 characters, end_marker should be
-    // more than 13 minus the 4 whitespaces we have trimmed from the
-    // start so more than 9
-    //
-    // However, free format MPS can have names with only one character
-    // (pyomo.mps). Have to distinguish this from 8-character names
-    // with spaces. Best bet is to see whether "marker" is in the set
-    // of row names. If it is, then assume that the names are short
-    if (end_marker < 9) {
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      // Detect whether the file is in fixed format with spaces in
+      // names, even if there are no known examples!
+      //
+      // end_marker should be the end index of the row name:
+      //
+      // If the names are at least 8 characters, end_marker should be
+      // more than 13 minus the 4 whitespaces we have trimmed from the
+      // start so more than 9
+      //
+      // However, free format MPS can have names with only one character
+      // (pyomo.mps). Have to distinguish this from 8-character names
+      // with spaces. Best bet is to see whether "marker" is in the set
+      // of row names. If it is, then assume that the names are short
+      if (line.end_marker < 9 && !line.entry[0].row_found) {
         // marker is not a row name, so continue to look at name
-        std::string name = strline.substr(0, 10);
+        std::string name = batch[i].substr(0, 10);
         // Delete trailing spaces
         name = trim(name);
         if (name.size() > 8) {
@@ -763,159 +843,69 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
           return HMpsFF::Parsekey::kFixedFormat;
         }
       }
-    }
 
-    // Test for new column
-    if (!(word == colname)) {
-      // Record the nonzeros in any previous column
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
-        }
-        col_count = 0;
-      }
-      assert(!col_cost);
-      colname = word;
-      auto ret = colname2idx.emplace(colname, num_col++);
-      col_names.push_back(colname);
-      if (!ret.second) {
-        // Duplicate col name
-        if (!has_duplicate_col_name_) {
-          // This is the first so record it
-          has_duplicate_col_name_ = true;
-          auto mit = colname2idx.find(colname);
-          assert(mit != colname2idx.end());
-          duplicate_col_name_ = colname;
-          duplicate_col_name_index0_ = mit->second;
-          duplicate_col_name_index1_ = num_col - 1;
+      // Test for new column
+      if (!(line.col_name == colname)) {
+        // Record the nonzeros in any previous column
+        if (num_col) recordColumn();
+        assert(!col_cost);
+        colname = line.col_name;
+        const HighsInt colidx0 = col_name_hash.find(col_names, colname);
+        col_names.push_back(colname);
+        num_col++;
+        if (colidx0 == kHashNotFound) {
+          col_name_hash.insert(col_names, num_col - 1);
+        } else {
+          // Duplicate col name
+          if (!has_duplicate_col_name_) {
+            // This is the first so record it
+            has_duplicate_col_name_ = true;
+            duplicate_col_name_ = colname;
+            duplicate_col_name_index0_ = colidx0;
+            duplicate_col_name_index1_ = num_col - 1;
+          }
         }
-      }
-
-      // Mark the column as integer, according to whether
-      // the integral_cols flag is set
-      col_integrality.push_back(integral_cols ? HighsVarType::kInteger
-                                              : HighsVarType::kContinuous);
-      // Mark the column as binary as well
-      col_binary.push_back(integral_cols && kintegerVarsInColumnsAreBinary);
-
-      // initialize with default bounds
-      col_lower.push_back(0.0);
-      col_upper.push_back(kHighsInf);
-    }
 
-    assert(num_col > 0);
+        // Mark the column as integer, according to whether
+        // the integral_cols flag is set
+        col_integrality.push_back(integral_cols ? HighsVarType::kInteger
+                                                : HighsVarType::kContinuous);
+        // Mark the column as binary as well
+        col_binary.push_back(integral_cols && kintegerVarsInColumnsAreBinary);
 
-    // here marker is the row name and end marks its end
-    word = "";
-    word = first_word(strline, end_marker);
-    end = first_word_end(strline, end_marker);
-
-    if (word == "") {
-      trim(marker);
-      highsLogUser(log_options, HighsLogType::kError,
-                   "No coefficient given for column \"%s\"\n", marker.c_str());
-      return HMpsFF::Parsekey::kFail;
-    }
-
-    auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
-      highsLogUser(
-          log_options, HighsLogType::kWarning,
-          "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
-          marker.c_str());
-    } else {
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
-        }
+        // initialize with default bounds
+        col_lower.push_back(0.0);
+        col_upper.push_back(kHighsInf);
       }
-    }
 
-    if (!is_end(strline, end)) {
-      // parse second coefficient
-      marker = first_word(strline, end);
-      if (word == "") {
-        trim(marker);
+      assert(num_col > 0);
+
+      if (!line.has_coefficient) {
         highsLogUser(log_options, HighsLogType::kError,
                      "No coefficient given for column \"%s\"\n",
-                     marker.c_str());
+                     line.entry[0].row_name.c_str());
         return HMpsFF::Parsekey::kFail;
       }
-      end_marker = first_word_end(strline, end);
-
-      // here marker is the row name and end marks its end
-      word = "";
-      end_marker++;
-      word = first_word(strline, end_marker);
-      end = first_word_end(strline, end_marker);
-
-      assert(is_end(strline, end));
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
-        highsLogUser(
-            log_options, HighsLogType::kWarning,
-            "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
-            marker.c_str());
-        continue;
-      };
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
+      for (HighsInt k = 0; k < line.num_entry; ++k) {
+        const ColsEntry& entry = line.entry[k];
+        if (!entry.row_found) {
+          highsLogUser(
+              log_options, HighsLogType::kWarning,
+              "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
+              entry.row_name.c_str());
+          continue;
         }
+        if (entry.value) addEntry(entry);
       }
     }
   }
 
-  return Parsekey::kFail;
+  if (key == Parsekey::kNone) return Parsekey::kFail;
+
+  if (num_col) recordColumn();
+  highsLogDev(log_options, HighsLogType::kInfo, "readMPS: Read COLUMNS OK\n");
+  return key;
 }
 
 HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
@@ -924,10 +914,8 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx,
                           bool& has_entry) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    rowidx = getRowIdx(name);
+    assert(rowidx != kNoRowIdx);
 
     assert(rowidx < num_row);
 
@@ -997,7 +985,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
     // Ignore lack of name for SIF format;
     // we know we have this case when "word" is a row name
     if ((key == Parsekey::kNone) && (key != Parsekey::kRhs) &&
-        (rowname2idx.find(word) != rowname2idx.end())) {
+        (getRowIdx(word) != kNoRowIdx)) {
       end = begin;
     }
 
@@ -1018,13 +1006,13 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
       return HMpsFF::Parsekey::kFail;
     }
 
-    auto mit = rowname2idx.find(marker);
+    bool row_found = getRowIdx(marker) != kNoRowIdx;
 
     // SIF format sometimes has the name of the MPS file
     // prepended to the RHS entry; remove it here if
     // that's the case. "word" will then hold the marker,
     // so also get new "word" and "end" values
-    if (mit == rowname2idx.end()) {
+    if (!row_found) {
       if (marker == mps_name) {
         marker = word;
         end_marker = end;
@@ -1037,11 +1025,11 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
                        "No bound given for SIF row \"%s\"\n", marker.c_str());
           return HMpsFF::Parsekey::kFail;
         }
-        mit = rowname2idx.find(marker);
+        row_found = getRowIdx(marker) != kNoRowIdx;
       }
     }
 
-    if (mit == rowname2idx.end()) {
+    if (!row_found) {
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in RHS section is not defined: ignored\n",
                    marker.c_str());
@@ -1053,7 +1041,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
                      "ignored\n",
                      marker.c_str());
       } else {
-        double value = atof(word.c_str());
+        double value = strToDouble(word);
         addRhs(value, rowidx);
       }
     }
@@ -1078,8 +1066,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 
       assert(is_end(strline, end));
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      if (getRowIdx(marker) == kNoRowIdx) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "Row name \"%s\" in RHS section is not defined: ignored\n",
                      marker.c_str());
@@ -1093,7 +1080,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
                      "ignored\n",
                      marker.c_str());
       } else {
-        double value = atof(word.c_str());
+        double value = strToDouble(word);
         addRhs(value, rowidx);
       }
     }
@@ -1252,7 +1239,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
 
     std::string marker;
     size_t end_marker;
-    if (colname2idx.find(bound_name) != colname2idx.end()) {
+    if (getColIdx(bound_name, false) >= 0) {
       // SIF format might not have the bound name, so skip
       // it here if we found the marker instead
       marker = bound_name;
@@ -1327,7 +1314,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
                    marker.c_str());
       return HMpsFF::Parsekey::kFail;
     }
-    double value = atof(word.c_str());
+    double value = strToDouble(word);
     if (is_integral) {
       assert(is_lb || is_ub || is_semi);
       // Must be LI, UI or SI, and value should be integer
@@ -1368,10 +1355,8 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
   std::string strline, word;
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    rowidx = getRowIdx(name);
+    assert(rowidx != kNoRowIdx);
 
     assert(rowidx < num_row);
   };
@@ -1436,8 +1421,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
       return HMpsFF::Parsekey::kFail;
     }
 
-    auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
+    if (getRowIdx(marker) == kNoRowIdx) {
       highsLogUser(
           log_options, HighsLogType::kWarning,
           "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1455,7 +1439,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
                      "definition: ignored\n",
                      marker.c_str());
       } else {
-        double value = atof(word.c_str());
+        double value = strToDouble(word);
         addRhs(value, rowidx);
       }
     }
@@ -1476,8 +1460,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
         return HMpsFF::Parsekey::kFail;
       }
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      if (getRowIdx(marker) == kNoRowIdx) {
         highsLogUser(
             log_options, HighsLogType::kWarning,
             "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1495,7 +1478,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
                        "definition: ignored\n",
                        marker.c_str());
         } else {
-          double value = atof(word.c_str());
+          double value = strToDouble(word);
           addRhs(value, rowidx);
         }
       }
@@ -1590,7 +1573,7 @@ typename HMpsFF::Parsekey HMpsFF::parseHessian(
       rowidx = getColIdx(row_name);
       assert(rowidx >= 0 && rowidx < num_col);
 
-      double coeff = atof(coeff_name.c_str());
+      double coeff = strToDouble(coeff_name);
       if (coeff) {
         if (qmatrix) {
           // QMATRIX has the whole Hessian, so store the entry if the
@@ -1644,10 +1627,10 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
     return HMpsFF::Parsekey::kFail;
   }
 
-  auto mit = rowname2idx.find(rowname);
+  rowidx = getRowIdx(rowname);
   // if row of section does not exist or is free (index -2), then skip
-  if (mit == rowname2idx.end() || mit->second == -2) {
-    if (mit == rowname2idx.end())
+  if (rowidx == kNoRowIdx || rowidx == -2) {
+    if (rowidx == kNoRowIdx)
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in %s section is not defined: ignored\n",
                    rowname.c_str(), section_name.c_str());
@@ -1666,7 +1649,6 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
     }
     return Parsekey::kFail;  // unexpected end of file
   }
-  rowidx = mit->second;
   assert(rowidx >= -1);
   assert(rowidx < num_row);
 
@@ -1732,7 +1714,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
       qrowidx = getColIdx(row_name);
       assert(qrowidx >= 0 && qrowidx < num_col);
 
-      double coeff = atof(coeff_name.c_str());
+      double coeff = strToDouble(coeff_name);
       if (coeff) {
         if (qcmatrix) {
           // QCMATRIX has the whole Hessian, so store the entry if the
@@ -1815,7 +1797,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCones(const HighsLogOptions& log_options,
 
   cone_name.push_back(conename);
   cone_type.push_back(conetype);
-  cone_param.push_back(atof(coneparam.c_str()));
+  cone_param.push_back(strToDouble(coneparam));
   cone_entries.push_back(std::vector<HighsInt>());
 
   // now parse the cone entries: one column per line
@@ -1953,7 +1935,7 @@ typename HMpsFF::Parsekey HMpsFF::parseSos(const HighsLogOptions& log_options,
     double weight = 0.0;
     if (!is_end(strline, end)) {
       word = first_word(strline, end);
-      weight = atof(word.c_str());
+      weight = strToDouble(word);
     }
 
     sos_entries.back().push_back(std::make_pair(colidx, weight));
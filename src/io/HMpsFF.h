@@ -27,7 +27,6 @@
 #include <map>
 #include <memory>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -162,6 +161,8 @@ class HMpsFF {
     kTimeout
   };
 
+  static const HighsInt kNoRowIdx = -3;
+
   enum class Boundtype { kLe, kEq, kGe };  //, kFr };
 
   // see https://docs.mosek.com/latest/capi/mps-format.html#csection-optional
@@ -184,16 +185,49 @@ class HMpsFF {
   std::vector<ConeType> cone_type;
   std::vector<double> cone_param;
   std::vector<std::vector<HighsInt>> cone_entries;
-  std::unordered_map<std::string, int> rowname2idx;
-  std::unordered_map<std::string, int> colname2idx;
+  // Rows and columns are indexed by hashing their names in row_names
+  // and col_names, so each name is held only once. The names of the
+  // objective and free rows aren't in row_names, so are held in
+  // other_row_names, with index -1 or -2 in other_row_idx
+  HighsNameHash row_name_hash;
+  HighsNameHash col_name_hash;
+  HighsNameHash other_row_name_hash;
+  std::vector<std::string> other_row_names;
+  std::vector<HighsInt> other_row_idx;
 
   mutable std::string section_args;
 
+  // Row entry of a line in the COLUMNS section
+  struct ColsEntry {
+    std::string row_name;
+    bool row_found = false;
+    HighsInt row_idx = -1;
+    double value = 0;
+  };
+
+  // Line in the COLUMNS section, tokenised independently of the
+  // parser state
+  struct ColsLine {
+    std::string col_name;
+    bool is_marker = false;
+    bool has_coefficient = false;
+    size_t end_marker = 0;
+    HighsInt num_entry = 0;
+    ColsEntry entry[2];
+  };
+
   FreeFormatParserReturnCode parse(const HighsLogOptions& log_options,
                                    const std::string& filename);
   // Checks first word of strline and wraps it by it_begin and it_end
   HMpsFF::Parsekey checkFirstWord(std::string& strline, size_t& start,
                                   size_t& end, std::string& word) const;
+  void tokeniseColsLine(std::string& strline, ColsLine& line) const;
+
+  // Get index of row from row name: -1 for the objective, -2 for a
+  // free row, and kNoRowIdx if there is no row with the name
+  HighsInt getRowIdx(const std::string& rowname) const;
+  // Add a row name with its index, returning false if it is a duplicate
+  bool addRowName(const std::string& rowname, const HighsInt rowidx);
 
   // Get index of column from column name, possibly adding new column
   // if no index is found
@@ -13,12 +13,16 @@
  */
 #include "io/HighsIO.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdarg>
 #include <cstdio>
 
+#include <vector>
+
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsOptions.h"
+#include "parallel/HighsParallel.h"
 
 void highsLogHeader(const HighsLogOptions& log_options) {
   highsLogUser(log_options, HighsLogType::kInfo, "Running HiGHS %d.%d.%d: %s\n",
@@ -255,6 +259,63 @@ std::string highsFormatToString(const char* format, ...) {
   return std::string(msgbuffer);
 }
 
+void highsAppendFormat(std::string& buffer, const char* format, ...) {
+  va_list argptr;
+  va_start(argptr, format);
+  char msgbuffer[kIoBufferSize];
+  va_list argptr_copy;
+  va_copy(argptr_copy, argptr);
+  int len = vsnprintf(msgbuffer, sizeof(msgbuffer), format, argptr);
+  if (len < (int)sizeof(msgbuffer)) {
+    if (len > 0) buffer.append(msgbuffer, len);
+  } else {
+    // Too long for the local buffer, so format directly into the
+    // end of buffer
+    const size_t size = buffer.size();
+    buffer.resize(size + len + 1);
+    vsnprintf(&buffer[size], len + 1, format, argptr_copy);
+    buffer.resize(size + len);
+  }
+  va_end(argptr_copy);
+  va_end(argptr);
+}
+
+void highsWriteChunked(
+    FILE* file, const HighsInt num_item,
+    const std::function<void(HighsInt from, HighsInt to, std::string& buffer)>&
+        format_chunk) {
+  // Items are formatted in chunks of kChunkSize, and a batch of
+  // chunks is formatted before being written so that the memory
+  // required is bounded
+  const HighsInt kChunkSize = 4096;
+  const bool run_parallel =
+      HighsTaskExecutor::isInitialized() && highs::parallel::num_threads() > 1;
+  const HighsInt num_chunk_in_batch =
+      run_parallel ? 4 * highs::parallel::num_threads() : 1;
+  std::vector<std::string> buffers(num_chunk_in_batch);
+  for (HighsInt batch_from = 0; batch_from < num_item;
+       batch_from += num_chunk_in_batch * kChunkSize) {
+    const HighsInt num_chunk = std::min(
+        num_chunk_in_batch,
+        (num_item - batch_from + kChunkSize - 1) / kChunkSize);
+    auto formatChunks = [&](HighsInt chunk_from, HighsInt chunk_to) {
+      for (HighsInt iChunk = chunk_from; iChunk < chunk_to; iChunk++) {
+        const HighsInt from = batch_from + iChunk * kChunkSize;
+        const HighsInt to = std::min(from + kChunkSize, num_item);
+        buffers[iChunk].clear();
+        format_chunk(from, to, buffers[iChunk]);
+      }
+    };
+    if (run_parallel && num_chunk > 1) {
+      highs::parallel::for_each(0, num_chunk, formatChunks, 1);
+    } else {
+      formatChunks(0, num_chunk);
+    }
+    for (HighsInt iChunk = 0; iChunk < num_chunk; iChunk++)
+      fwrite(buffers[iChunk].data(), 1, buffers[iChunk].size(), file);
+  }
+}
+
 const std::string highsBoolToString(const bool b, const HighsInt field_width) {
   const HighsInt abs_field_width = std::abs(field_width);
   if (abs_field_width <= 1) return b ? "T" : "F";
@@ -15,7 +15,9 @@
 #define HIGHS_IO_H
 
 #include <array>
+#include <functional>
 #include <iostream>
+#include <string>
 
 #include "lp_data/HighsCallback.h"
 //#include "util/HighsInt.h"
@@ -92,6 +94,22 @@ void highsReportLogOptions(const HighsLogOptions& log_options_);
 
 std::string highsFormatToString(const char* format, ...);
 
+/**
+ * @brief Append formatted text to a buffer, with no limit on its length
+ */
+void highsAppendFormat(std::string& buffer, const char* format, ...);
+
+/**
+ * @brief Write the text for items [0, num_item) to a file in large
+ * blocks. The text for each chunk of items [from, to) is formatted by
+ * format_chunk into its own buffer, in parallel if the task scheduler
+ * has more than one thread, and the chunks are written in order
+ */
+void highsWriteChunked(
+    FILE* file, const HighsInt num_item,
+    const std::function<void(HighsInt from, HighsInt to, std::string& buffer)>&
+        format_chunk);
+
 const std::string highsBoolToString(const bool b,
                                     const HighsInt field_width = 2);
 
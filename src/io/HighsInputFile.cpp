@@ -0,0 +1,240 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsInputFile.cpp
+ * @brief
+ */
+#include "io/HighsInputFile.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "HConfig.h"  // for ZLIB_FOUND
+#ifdef ZLIB_FOUND
+#include "zstr/zstr.hpp"
+#endif
+
+#ifdef ZLIB_FOUND
+namespace {
+
+// The stream buffers below throw this when the source can't be read,
+// such as when compressed data are corrupt. The istream catches it and
+// sets badbit, so a reader sees an error rather than the end of the
+// file, and doesn't accept a truncated model
+void throwReadError() {
+  throw std::ios_base::failure("Unable to read compressed data");
+}
+
+// Stream buffer that reads from a source stream buffer in chunks on the
+// calling thread. Once the source has failed, every read fails
+class CheckedStreambuf : public std::streambuf {
+ public:
+  explicit CheckedStreambuf(std::unique_ptr<std::streambuf> source)
+      : source_(std::move(source)), buffer_(kChunkSize) {}
+
+ protected:
+  int_type underflow() override {
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    setg(nullptr, nullptr, nullptr);
+    if (failed_) throwReadError();
+    std::streamsize num_read = 0;
+    try {
+      num_read = source_->sgetn(buffer_.data(), kChunkSize);
+    } catch (...) {
+      failed_ = true;
+      throwReadError();
+    }
+    if (num_read <= 0) return traits_type::eof();
+    setg(buffer_.data(), buffer_.data(), buffer_.data() + num_read);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  static const std::size_t kChunkSize = 1 << 16;
+
+  std::unique_ptr<std::streambuf> source_;
+  std::vector<char> buffer_;
+  bool failed_ = false;
+};
+
+// Stream buffer that reads from a source stream buffer on its own
+// thread, holding up to kMaxChunk chunks of data ahead of the reader.
+//
+// The producer isn't a task of the HiGHS task executor because it
+// blocks on a condition variable whenever the reader falls behind, for
+// as long as the file is open. Tasks of the executor must not block: a
+// worker waiting for the reader could be the one that the reader's own
+// parallel loops (such as the MPS COLUMNS tokenisation) wait for, and
+// with threads=1 there is no worker at all.
+class ReadAheadStreambuf : public std::streambuf {
+ public:
+  explicit ReadAheadStreambuf(std::unique_ptr<std::streambuf> source)
+      : source_(std::move(source)) {
+    thread_ = std::thread([this]() { produce(); });
+  }
+
+  ~ReadAheadStreambuf() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    not_full_.notify_one();
+    thread_.join();
+  }
+
+ protected:
+  int_type underflow() override {
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!current_.empty()) free_.push_back(std::move(current_));
+    not_empty_.wait(lock, [this]() { return !full_.empty() || done_; });
+    if (full_.empty()) {
+      current_.clear();
+      setg(nullptr, nullptr, nullptr);
+      if (failed_) throwReadError();
+      return traits_type::eof();
+    }
+    current_ = std::move(full_.front());
+    full_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    setg(current_.data(), current_.data(), current_.data() + current_.size());
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  static const std::size_t kChunkSize = 1 << 20;
+  static const std::size_t kMaxChunk = 4;
+
+  void produce() {
+    while (true) {
+      std::vector<char> chunk;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock,
+                       [this]() { return full_.size() < kMaxChunk || stop_; });
+        if (stop_) break;
+        if (!free_.empty()) {
+          chunk = std::move(free_.back());
+          free_.pop_back();
+        }
+      }
+      chunk.resize(kChunkSize);
+      std::streamsize num_read = 0;
+      try {
+        num_read = source_->sgetn(chunk.data(), kChunkSize);
+      } catch (...) {
+        // The error is reported to the reader once it has read the
+        // chunks before it
+        std::lock_guard<std::mutex> lock(mutex_);
+        failed_ = true;
+        break;
+      }
+      if (num_read <= 0) break;
+      chunk.resize(num_read);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        full_.push_back(std::move(chunk));
+      }
+      not_empty_.notify_one();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      done_ = true;
+    }
+    not_empty_.notify_one();
+  }
+
+  std::unique_ptr<std::streambuf> source_;
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<std::vector<char>> full_;
+  std::vector<std::vector<char>> free_;
+  std::vector<char> current_;
+  bool done_ = false;
+  bool failed_ = false;
+  bool stop_ = false;
+};
+
+}  // namespace
+#endif
+
+HighsInputFile::HighsInputFile() : std::istream(nullptr) {}
+
+HighsInputFile::~HighsInputFile() { close(); }
+
+HighsInputFileCompression HighsInputFile::detectCompression(
+    const std::string& filename) {
+  unsigned char magic[4] = {0, 0, 0, 0};
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  file.read(reinterpret_cast<char*>(magic), 4);
+  if (file.gcount() >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+    return HighsInputFileCompression::kGzip;
+  if (file.gcount() == 4 && magic[0] == 0x28 && magic[1] == 0xb5 &&
+      magic[2] == 0x2f && magic[3] == 0xfd)
+    return HighsInputFileCompression::kZstd;
+  return HighsInputFileCompression::kNone;
+}
+
+bool HighsInputFile::open(const std::string& filename) {
+  close();
+  compression_ = detectCompression(filename);
+  std::unique_ptr<std::filebuf> file_buf(new std::filebuf());
+  std::ios_base::openmode mode = std::ios_base::in;
+#ifdef _WIN32
+  // to avoid problems with conversion of \r\n, as for zstr
+  if (compression_ != HighsInputFileCompression::kNone)
+    mode |= std::ios_base::binary;
+#endif
+  if (!file_buf->open(filename, mode)) return false;
+  switch (compression_) {
+    case HighsInputFileCompression::kNone:
+      break;
+    case HighsInputFileCompression::kGzip:
+#ifdef ZLIB_FOUND
+    {
+      std::unique_ptr<std::streambuf> inflate_buf(
+          new zstr::istreambuf(file_buf.get()));
+      // The inflating buffer is always wrapped, so that corrupt data
+      // are reported as a read error
+      if (std::thread::hardware_concurrency() > 1) {
+        stream_buf_.reset(new ReadAheadStreambuf(std::move(inflate_buf)));
+      } else {
+        stream_buf_.reset(new CheckedStreambuf(std::move(inflate_buf)));
+      }
+      break;
+    }
+#else
+      return false;
+#endif
+    case HighsInputFileCompression::kZstd:
+      return false;
+  }
+  file_buf_ = std::move(file_buf);
+  rdbuf(stream_buf_ ? stream_buf_.get() : file_buf_.get());
+  clear();
+  open_ = true;
+  return true;
+}
+
+void HighsInputFile::close() {
+  rdbuf(nullptr);
+  // The decompressing buffer reads from the file buffer, so must go
+  // first
+  stream_buf_.reset();
+  file_buf_.reset();
+  open_ = false;
+}
@@ -0,0 +1,53 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsInputFile.h
+ * @brief Input stream for model files that may be compressed
+ *
+ * Whether a file is gzip-compressed is determined from its contents,
+ * so all file readers handle compressed and plain files in the same
+ * way. When more than one hardware thread is available, decompression
+ * runs on a separate thread that keeps a few chunks of inflated data
+ * ahead of the parser. Corrupt compressed data set badbit on the
+ * stream, rather than appearing to end the file.
+ */
+#ifndef IO_HIGHS_INPUT_FILE_H_
+#define IO_HIGHS_INPUT_FILE_H_
+
+#include <istream>
+#include <memory>
+#include <string>
+
+enum class HighsInputFileCompression { kNone = 0, kGzip, kZstd };
+
+class HighsInputFile : public std::istream {
+ public:
+  HighsInputFile();
+  ~HighsInputFile();
+
+  // Open the file, returning false if it can't be opened or is
+  // compressed in a format that this build can't read
+  bool open(const std::string& filename);
+  bool is_open() const { return open_; }
+  void close();
+  HighsInputFileCompression compression() const { return compression_; }
+
+  // Compression format indicated by the first bytes of a file
+  static HighsInputFileCompression detectCompression(
+      const std::string& filename);
+
+ private:
+  std::unique_ptr<std::streambuf> file_buf_;
+  std::unique_ptr<std::streambuf> stream_buf_;
+  HighsInputFileCompression compression_ = HighsInputFileCompression::kNone;
+  bool open_ = false;
+};
+
+#endif
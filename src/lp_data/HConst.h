@@ -276,6 +276,8 @@ const double kExcessivePrimalValue = 1e25;
 
 // Hash marker for duplicates
 const HighsInt kHashIsDuplicate = -1;
+// Hash marker for a name that is not found
+const HighsInt kHashNotFound = -2;
 
 // Tolerance values for highsDoubleToString
 const double kModelValueToStringTolerance = 1e-15;
@@ -14,6 +14,8 @@
 #ifndef LP_DATA_HSTRUCT_H_
 #define LP_DATA_HSTRUCT_H_
 
+#include <cstdint>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -113,10 +115,25 @@ struct HighsLpMods {
   bool isClear();
 };
 
+// Open-addressing index of a vector of names. Names aren't copied:
+// each slot holds part of the hash of a name and its position in the
+// vector, so the vector of names is passed to each call
 struct HighsNameHash {
-  std::unordered_map<std::string, int> name2index;
+  struct Slot {
+    uint32_t hash;
+    HighsInt entry;
+  };
+  std::vector<Slot> slot;
+  HighsInt num_entry = 0;
   void form(const std::vector<std::string>& name);
   bool hasDuplicate(const std::vector<std::string>& name);
+  // Position of key in name, kHashIsDuplicate if it occurs more than
+  // once, or kHashNotFound
+  HighsInt find(const std::vector<std::string>& name,
+                const std::string& key) const;
+  // Index name[index], returning false if it's a duplicate
+  bool insert(const std::vector<std::string>& name, const HighsInt index);
+  HighsInt size() const { return num_entry; }
   void clear();
 };
 
@@ -19,9 +19,12 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "io/Filereader.h"
+#include "io/FilereaderHbin.h"
 #include "io/LoadOptions.h"
 #include "lp_data/HighsCallbackStruct.h"
 #include "lp_data/HighsInfoDebug.h"
@@ -37,6 +40,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "util/HighsMatrixPic.h"
 #include "util/HighsSort.h"
+#include "util/HighsTrace.h"
 
 #define STRINGFY(s) STRINGFY0(s)
 #define STRINGFY0(s) #s
@@ -50,7 +54,29 @@ HighsInt highsVersionPatch() { return HIGHS_VERSION_PATCH; }
 const char* highsGithash() { return HIGHS_GITHASH; }
 const char* highsCompilationDate() { return HIGHS_COMPILATION_DATE; }
 
-Highs::Highs() {}
+namespace {
+// Run a write on a detached thread. Unlike a future from std::async,
+// the future returned doesn't block in its destructor, so the write
+// is asynchronous even if the caller discards it
+template <typename Write>
+std::future<HighsStatus> writeDetached(Write write) {
+  std::shared_ptr<std::promise<HighsStatus>> promise =
+      std::make_shared<std::promise<HighsStatus>>();
+  std::future<HighsStatus> result = promise->get_future();
+  std::thread([promise, write]() {
+    try {
+      promise->set_value(write());
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  }).detach();
+  return result;
+}
+}  // namespace
+
+Highs::Highs() : metrics_(std::make_shared<HighsMetrics>()) {
+  ekk_instance_.metrics_ = metrics_.get();
+}
 
 HighsStatus Highs::clear() {
   resetOptions();
@@ -59,6 +85,8 @@ HighsStatus Highs::clear() {
 
 HighsStatus Highs::clearModel() {
   model_.clear();
+  mip_root_basis_.clear();
+  mip_root_row_dual_.clear();
   return clearSolver();
 }
 
@@ -71,24 +99,30 @@ HighsStatus Highs::clearSolver() {
 
 HighsStatus Highs::setOptionValue(const std::string& option, const bool value) {
   if (setLocalOptionValue(options_.log_options, option, options_.records,
-                          value) == OptionStatus::kOk)
+                          value) == OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
 HighsStatus Highs::setOptionValue(const std::string& option,
                                   const HighsInt value) {
   if (setLocalOptionValue(options_.log_options, option, options_.records,
-                          value) == OptionStatus::kOk)
+                          value) == OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
 HighsStatus Highs::setOptionValue(const std::string& option,
                                   const double value) {
   if (setLocalOptionValue(options_.log_options, option, options_.records,
-                          value) == OptionStatus::kOk)
+                          value) == OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
@@ -96,8 +130,10 @@ HighsStatus Highs::setOptionValue(const std::string& option,
                                   const std::string& value) {
   HighsLogOptions report_log_options = options_.log_options;
   if (setLocalOptionValue(report_log_options, option, options_.log_options,
-                          options_.records, value) == OptionStatus::kOk)
+                          options_.records, value) == OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
@@ -105,8 +141,10 @@ HighsStatus Highs::setOptionValue(const std::string& option,
                                   const char* value) {
   HighsLogOptions report_log_options = options_.log_options;
   if (setLocalOptionValue(report_log_options, option, options_.log_options,
-                          options_.records, value) == OptionStatus::kOk)
+                          options_.records, value) == OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
@@ -117,6 +155,8 @@ HighsStatus Highs::readOptions(const std::string& filename) {
     return HighsStatus::kWarning;
   }
   HighsLogOptions report_log_options = options_.log_options;
+  // Options may be changed even if there is an error in the file
+  optionChangeAction();
   switch (loadOptionsFromFile(report_log_options, options_, filename)) {
     case HighsLoadOptionsStatus::kError:
     case HighsLoadOptionsStatus::kEmpty:
@@ -129,13 +169,16 @@ HighsStatus Highs::readOptions(const std::string& filename) {
 
 HighsStatus Highs::passOptions(const HighsOptions& options) {
   if (passLocalOptions(options_.log_options, options, options_) ==
-      OptionStatus::kOk)
+      OptionStatus::kOk) {
+    optionChangeAction();
     return HighsStatus::kOk;
+  }
   return HighsStatus::kError;
 }
 
 HighsStatus Highs::resetOptions() {
   resetLocalOptions(options_.records);
+  optionChangeAction();
   return HighsStatus::kOk;
 }
 
@@ -292,7 +335,12 @@ HighsStatus Highs::writeInfo(const std::string& filename) const {
 // Methods below change the incumbent model or solver information
 // associated with it. Hence returnFromHighs is called at the end of
 // each
-HighsStatus Highs::passModel(HighsModel model) {
+HighsStatus Highs::passModel(const HighsModel& model) {
+  HighsModel model_copy = model;
+  return passModel(std::move(model_copy));
+}
+
+HighsStatus Highs::passModel(HighsModel&& model) {
   // This is the "master" Highs::passModel, in that all the others
   // eventually call it
   this->logHeader();
@@ -335,15 +383,22 @@ HighsStatus Highs::passModel(HighsModel model) {
   if (!hessian.formatOk()) return HighsStatus::kError;
   // Ensure that the LP is column-wise
   lp.ensureColwise();
-  // Check validity of the LP, normalising its values
-  return_status = interpretCallStatus(
-      options_.log_options, assessLp(lp, options_), return_status, "assessLp");
-  if (return_status == HighsStatus::kError) return return_status;
-  // Check validity of any Hessian, normalising its entries
-  return_status = interpretCallStatus(options_.log_options,
-                                      assessHessian(hessian, options_),
-                                      return_status, "assessHessian");
-  if (return_status == HighsStatus::kError) return return_status;
+  if (model_is_trusted_) {
+    // The model was written by HiGHS, so has been assessed already
+    // and its matrices are in normalised form
+    lp.has_infinite_cost_ = lp.hasInfiniteCost(options_.infinite_cost);
+  } else {
+    // Check validity of the LP, normalising its values
+    return_status =
+        interpretCallStatus(options_.log_options, assessLp(lp, options_),
+                            return_status, "assessLp");
+    if (return_status == HighsStatus::kError) return return_status;
+    // Check validity of any Hessian, normalising its entries
+    return_status = interpretCallStatus(options_.log_options,
+                                        assessHessian(hessian, options_),
+                                        return_status, "assessHessian");
+    if (return_status == HighsStatus::kError) return return_status;
+  }
   if (hessian.dim_) {
     // Clear any zero Hessian
     if (hessian.numNz() == 0) {
@@ -362,12 +417,29 @@ HighsStatus Highs::passModel(HighsModel model) {
   return returnFromHighs(return_status);
 }
 
-HighsStatus Highs::passModel(HighsLp lp) {
+HighsStatus Highs::passModel(const HighsLp& lp) {
+  HighsModel model;
+  model.lp_ = lp;
+  return passModel(std::move(model));
+}
+
+HighsStatus Highs::passModel(HighsLp&& lp) {
   HighsModel model;
   model.lp_ = std::move(lp);
   return passModel(std::move(model));
 }
 
+HighsStatus Highs::passModel(HighsLpBuilder& builder) {
+  HighsLp lp;
+  if (builder.finalise(lp) != HighsStatus::kOk) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "LP builder has inconsistent matrix starts, or entries "
+                 "with invalid row or column indices\n");
+    return HighsStatus::kError;
+  }
+  return passModel(std::move(lp));
+}
+
 HighsStatus Highs::passModel(
     const HighsInt num_col, const HighsInt num_row, const HighsInt a_num_nz,
     const HighsInt q_num_nz, const HighsInt a_format, const HighsInt q_format,
@@ -596,6 +668,7 @@ HighsStatus Highs::readModel(const std::string& filename) {
   HighsModel model;
   FilereaderRetcode call_code =
       reader->readModelFromFile(options_, filename, model);
+  const bool is_hbin = dynamic_cast<FilereaderHbin*>(reader) != nullptr;
   delete reader;
   if (call_code != FilereaderRetcode::kOk) {
     interpretFilereaderRetcode(options_.log_options, filename.c_str(),
@@ -616,9 +689,13 @@ HighsStatus Highs::readModel(const std::string& filename) {
     // variable.
     removeRowsOfCountOne(options_.log_options, model.lp_);
   }
+  // A model read from a .hbin file need only be assessed if it
+  // might not have been written by HiGHS
+  model_is_trusted_ = is_hbin && options_.trust_hbin_model_file;
   return_status =
       interpretCallStatus(options_.log_options, passModel(std::move(model)),
                           return_status, "passModel");
+  model_is_trusted_ = false;
   return returnFromHighs(return_status);
 }
 
@@ -705,6 +782,39 @@ HighsStatus Highs::writeBasis(const std::string& filename) {
   return returnFromHighs(return_status);
 }
 
+std::future<HighsStatus> Highs::writeBasisAsync(const std::string& filename) {
+  if (filename == "") {
+    // Writing to stdout from another thread would be interleaved
+    // with logging
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeBasisAsync: cannot write to stdout\n");
+    std::promise<HighsStatus> error;
+    error.set_value(HighsStatus::kError);
+    return error.get_future();
+  }
+  FILE* file;
+  HighsFileType file_type;
+  HighsStatus return_status =
+      interpretCallStatus(options_.log_options,
+                          openWriteFile(filename, "writeBasisAsync", file,
+                                        file_type),
+                          HighsStatus::kOk, "openWriteFile");
+  if (return_status == HighsStatus::kError) {
+    std::promise<HighsStatus> error;
+    error.set_value(return_status);
+    return error.get_future();
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Writing the basis to %s\n", filename.c_str());
+  std::shared_ptr<HighsBasis> basis = std::make_shared<HighsBasis>(basis_);
+  return writeDetached([file, basis, return_status]() {
+    FILE* basis_file = file;
+    writeBasisFile(basis_file, *basis);
+    if (basis_file != stdout) fclose(basis_file);
+    return return_status;
+  });
+}
+
 HighsStatus Highs::presolve() {
   if (model_.needsMods(options_.infinite_cost)) {
     highsLogUser(options_.log_options, HighsLogType::kError,
@@ -720,10 +830,14 @@ HighsStatus Highs::presolve() {
   } else {
     const bool force_presolve = true;
     // make sure global scheduler is initialized before calling presolve, since
-    // MIP presolve may use parallelism
-    highs::parallel::initialize_scheduler(options_.threads);
+    // MIP presolve may use parallelism. Any attached executor is used
+    // in its place
+    HighsTaskExecutor::ScopedBinding executor_binding(task_executor_);
+    highs::parallel::initialize_scheduler(options_.threads,
+                                          schedulerConfig(options_));
     max_threads = highs::parallel::num_threads();
-    if (options_.threads != 0 && max_threads != options_.threads) {
+    if (!task_executor_ && options_.threads != 0 &&
+        max_threads != options_.threads) {
       highsLogUser(
           options_.log_options, HighsLogType::kError,
           "Option 'threads' is set to %d but global scheduler has already been "
@@ -785,6 +899,13 @@ HighsStatus Highs::presolve() {
     presolved_model_.lp_ = presolve_.getReducedProblem();
     presolved_model_.lp_.setMatrixDimensions();
   }
+  // Unless the incumbent model is modified, the result of LP presolve
+  // can be used by run() without presolving again
+  lp_presolve_reusable_ =
+      !model_.isMip() &&
+      (model_presolve_status_ == HighsPresolveStatus::kNotReduced ||
+       model_presolve_status_ == HighsPresolveStatus::kReduced ||
+       model_presolve_status_ == HighsPresolveStatus::kReducedToEmpty);
 
   highsLogUser(options_.log_options, HighsLogType::kInfo,
                "Presolve status: %s\n",
@@ -831,10 +952,17 @@ HighsStatus Highs::run() {
   if (ekk_instance_.status_.has_nla)
     assert(ekk_instance_.lpFactorRowCompatible(model_.lp_.num_row_));
 
-  highs::parallel::initialize_scheduler(options_.threads);
+  // Any attached executor is used by this thread until run() returns
+  HighsTaskExecutor::ScopedBinding executor_binding(task_executor_);
+  highs::parallel::initialize_scheduler(options_.threads,
+                                        schedulerConfig(options_));
+  // Events are traced until run() returns if there is a trace file
+  HighsTraceFile trace_file(options_.trace_file, options_.log_options);
+  metrics_->reset();
 
   max_threads = highs::parallel::num_threads();
-  if (options_.threads != 0 && max_threads != options_.threads) {
+  if (!task_executor_ && options_.threads != 0 &&
+      max_threads != options_.threads) {
     highsLogUser(
         options_.log_options, HighsLogType::kError,
         "Option 'threads' is set to %d but global scheduler has already been "
@@ -850,6 +978,8 @@ HighsStatus Highs::run() {
                 max_threads);
   highsLogDev(options_.log_options, HighsLogType::kDetailed,
               "Running with %" HIGHSINT_FORMAT " thread(s)\n", max_threads);
+  if (kHighsAnalysisLevelSolverRuntimeData & options_.highs_analysis_level)
+    HighsTaskExecutor::resetWorkerStats();
 
   // returnFromRun() is a common exit method to ensure consistency of
   // values set by run() and many other things. It's important to be
@@ -1161,8 +1291,19 @@ HighsStatus Highs::run() {
     const double from_presolve_time = timer_.read(timer_.presolve_clock);
     this_presolve_time = -from_presolve_time;
     timer_.start(timer_.presolve_clock);
-    const bool force_lp_presolve = true;
-    model_presolve_status_ = runPresolve(force_lp_presolve);
+    if (lp_presolve_reusable_) {
+      // The model has not been modified since it was presolved by a
+      // call to presolve(), so the reduced LP and postsolve stack
+      // can be used without presolving again
+      highsLogDev(options_.log_options, HighsLogType::kInfo,
+                  "Using presolve of unmodified LP: %s\n",
+                  presolveStatusToString(model_presolve_status_).c_str());
+      // The reduced LP is modified when it is solved
+      lp_presolve_reusable_ = false;
+    } else {
+      const bool force_lp_presolve = true;
+      model_presolve_status_ = runPresolve(force_lp_presolve);
+    }
     timer_.stop(timer_.presolve_clock);
     const double to_presolve_time = timer_.read(timer_.presolve_clock);
     this_presolve_time += to_presolve_time;
@@ -2186,6 +2327,7 @@ HighsStatus Highs::changeObjectiveOffset(const double offset) {
   info_.objective_function_value += (offset - model_.lp_.offset_);
   model_.lp_.offset_ = offset;
   presolved_model_.lp_.offset_ += offset;
+  lp_presolve_reusable_ = false;
   return returnFromHighs(HighsStatus::kOk);
 }
 
@@ -2599,19 +2741,19 @@ HighsStatus Highs::getColName(const HighsInt col, std::string& name) const {
 HighsStatus Highs::getColByName(const std::string& name, HighsInt& col) {
   HighsLp& lp = model_.lp_;
   if (!lp.col_names_.size()) return HighsStatus::kError;
-  if (!lp.col_hash_.name2index.size()) lp.col_hash_.form(lp.col_names_);
-  auto search = lp.col_hash_.name2index.find(name);
-  if (search == lp.col_hash_.name2index.end()) {
+  if (!lp.col_hash_.size()) lp.col_hash_.form(lp.col_names_);
+  const HighsInt search = lp.col_hash_.find(lp.col_names_, name);
+  if (search == kHashNotFound) {
     highsLogUser(options_.log_options, HighsLogType::kError,
                  "Highs::getColByName: name %s is not found\n", name.c_str());
     return HighsStatus::kError;
   }
-  if (search->second == kHashIsDuplicate) {
+  if (search == kHashIsDuplicate) {
     highsLogUser(options_.log_options, HighsLogType::kError,
                  "Highs::getColByName: name %s is duplicated\n", name.c_str());
     return HighsStatus::kError;
   }
-  col = search->second;
+  col = search;
   assert(lp.col_names_[col] == name);
   return HighsStatus::kOk;
 }
@@ -2701,19 +2843,19 @@ HighsStatus Highs::getRowName(const HighsInt row, std::string& name) const {
 HighsStatus Highs::getRowByName(const std::string& name, HighsInt& row) {
   HighsLp& lp = model_.lp_;
   if (!lp.row_names_.size()) return HighsStatus::kError;
-  if (!lp.row_hash_.name2index.size()) lp.row_hash_.form(lp.row_names_);
-  auto search = lp.row_hash_.name2index.find(name);
-  if (search == lp.row_hash_.name2index.end()) {
+  if (!lp.row_hash_.size()) lp.row_hash_.form(lp.row_names_);
+  const HighsInt search = lp.row_hash_.find(lp.row_names_, name);
+  if (search == kHashNotFound) {
     highsLogUser(options_.log_options, HighsLogType::kError,
                  "Highs::getRowByName: name %s is not found\n", name.c_str());
     return HighsStatus::kError;
   }
-  if (search->second == kHashIsDuplicate) {
+  if (search == kHashIsDuplicate) {
     highsLogUser(options_.log_options, HighsLogType::kError,
                  "Highs::getRowByName: name %s is duplicated\n", name.c_str());
     return HighsStatus::kError;
   }
-  row = search->second;
+  row = search;
   assert(lp.row_names_[row] == name);
   return HighsStatus::kOk;
 }
@@ -2854,6 +2996,8 @@ HighsStatus Highs::postsolve(const HighsSolution& solution,
                  presolveStatusToString(model_presolve_status_).c_str());
     return HighsStatus::kWarning;
   }
+  // Postsolve modifies the data of presolve_, so run() must not use it
+  lp_presolve_reusable_ = false;
   HighsStatus return_status = callRunPostsolve(solution, basis);
   return returnFromHighs(return_status);
 }
@@ -2891,7 +3035,7 @@ HighsStatus Highs::writeSolution(const std::string& filename,
         interpretCallStatus(options_.log_options, this->getRangingInterface(),
                             return_status, "getRangingInterface");
     if (return_status == HighsStatus::kError)
-      returnFromWriteSolution(file, return_status);
+      return returnFromWriteSolution(file, return_status);
     fprintf(file, "\n# Ranging\n");
     writeRangingFile(file, model_.lp_, info_.objective_function_value, basis_,
                      solution_, ranging_, style);
@@ -2899,6 +3043,94 @@ HighsStatus Highs::writeSolution(const std::string& filename,
   return returnFromWriteSolution(file, return_status);
 }
 
+namespace {
+// Copy of the data written by Highs::writeSolutionAsync
+struct HighsSolutionSnapshot {
+  HighsOptions options;
+  HighsModel model;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo info;
+  HighsModelStatus model_status;
+  HighsRanging ranging;
+  bool write_ranging;
+};
+}  // namespace
+
+std::future<HighsStatus> Highs::writeSolutionAsync(const std::string& filename,
+                                                   const HighsInt style) {
+  HighsStatus return_status = HighsStatus::kOk;
+  std::promise<HighsStatus> error;
+  if (filename == "") {
+    // Writing to stdout from another thread would be interleaved
+    // with logging
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeSolutionAsync: cannot write to stdout\n");
+    error.set_value(HighsStatus::kError);
+    return error.get_future();
+  }
+  FILE* file;
+  HighsFileType file_type;
+  return_status = interpretCallStatus(
+      options_.log_options,
+      openWriteFile(filename, "writeSolutionAsync", file, file_type),
+      return_status, "openWriteFile");
+  if (return_status == HighsStatus::kError) {
+    error.set_value(return_status);
+    return error.get_future();
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Writing the solution to %s\n", filename.c_str());
+  // Anything that depends on the solver is done before the snapshot
+  // is taken. As in writeSolution, if ranging information can't be
+  // determined then the solution is written without it, and the error
+  // is returned
+  bool write_ranging =
+      style != kSolutionStyleSparse && options_.ranging == kHighsOnString;
+  if (write_ranging) {
+    if (model_.isMip() || model_.isQp()) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "Cannot determine ranging information for MIP or QP\n");
+      return_status = HighsStatus::kError;
+    } else {
+      return_status = interpretCallStatus(options_.log_options,
+                                          this->getRangingInterface(),
+                                          return_status, "getRangingInterface");
+    }
+    if (return_status == HighsStatus::kError) write_ranging = false;
+  }
+  std::shared_ptr<HighsSolutionSnapshot> snapshot =
+      std::make_shared<HighsSolutionSnapshot>();
+  snapshot->options = options_;
+  snapshot->model = model_;
+  snapshot->basis = basis_;
+  snapshot->solution = solution_;
+  snapshot->info = info_;
+  snapshot->model_status = model_status_;
+  if (write_ranging) snapshot->ranging = ranging_;
+  snapshot->write_ranging = write_ranging;
+  return writeDetached([file, snapshot, style, return_status]() {
+    FILE* solution_file = file;
+    const HighsSolutionSnapshot& data = *snapshot;
+    writeSolutionFile(solution_file, data.options, data.model, data.basis,
+                      data.solution, data.info, data.model_status, style);
+    if (style != kSolutionStyleSparse) {
+      if (style == kSolutionStyleRaw) {
+        fprintf(solution_file, "\n# Basis\n");
+        writeBasisFile(solution_file, data.basis);
+      }
+      if (data.write_ranging) {
+        fprintf(solution_file, "\n# Ranging\n");
+        writeRangingFile(solution_file, data.model.lp_,
+                         data.info.objective_function_value, data.basis,
+                         data.solution, data.ranging, style);
+      }
+    }
+    if (solution_file != stdout) fclose(solution_file);
+    return return_status;
+  });
+}
+
 HighsStatus Highs::readSolution(const std::string& filename,
                                 const HighsInt style) {
   return readSolutionFile(filename, options_, model_.lp_, basis_, solution_,
@@ -2979,6 +3211,7 @@ void Highs::deprecationMessage(const std::string& method_name,
 HighsPresolveStatus Highs::runPresolve(const bool force_lp_presolve,
                                        const bool force_presolve) {
   presolve_.clear();
+  lp_presolve_reusable_ = false;
   // Exit if presolve is set to off (unless presolve is forced)
   if (options_.presolve == kHighsOffString && !force_presolve)
     return HighsPresolveStatus::kNotPresolved;
@@ -3116,10 +3349,17 @@ HighsPostsolveStatus Highs::runPostsolve() {
 
 void Highs::clearPresolve() {
   model_presolve_status_ = HighsPresolveStatus::kNotPresolved;
+  lp_presolve_reusable_ = false;
   presolved_model_.clear();
   presolve_.clear();
 }
 
+void Highs::optionChangeAction() {
+  // The result of presolve depends on the options, so can't be used
+  // by run() once they have changed
+  lp_presolve_reusable_ = false;
+}
+
 void Highs::invalidateUserSolverData() {
   invalidateModelStatus();
   invalidateSolution();
@@ -3447,7 +3687,29 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(callback_, options_, lp, solution_);
+  solver.metrics_ = metrics_.get();
+  HighsBasis root_basis;
+  if (options_.mip_root_warm_start) {
+    // Warm start the root node with the basis and row duals of the
+    // root LP of the previous MIP solve. Columns and rows added since
+    // then are nonbasic and basic respectively.
+    if (mip_root_basis_.valid) {
+      root_basis = mip_root_basis_;
+      root_basis.col_status.resize(lp.num_col_, HighsBasisStatus::kNonbasic);
+      root_basis.row_status.resize(lp.num_row_, HighsBasisStatus::kBasic);
+      solver.rootbasis = &root_basis;
+    }
+    if (!mip_root_row_dual_.empty()) solver.rootrowdual = &mip_root_row_dual_;
+  }
   solver.run();
+  if (options_.mip_root_warm_start && solver.root_basis_.valid) {
+    // Any columns and rows for semi-variables are at the end
+    mip_root_basis_ = std::move(solver.root_basis_);
+    mip_root_basis_.col_status.resize(model_.lp_.num_col_);
+    mip_root_basis_.row_status.resize(model_.lp_.num_row_);
+    mip_root_row_dual_ = std::move(solver.root_row_dual_);
+    mip_root_row_dual_.resize(model_.lp_.num_row_);
+  }
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
   // model status
@@ -3940,9 +4202,37 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status,
                              model_.isMip() && !options_.solve_relaxation;
   if (!solved_as_mip) reportSolvedLpQpStats();
 
+  if (kHighsAnalysisLevelSolverRuntimeData & options_.highs_analysis_level)
+    reportTaskExecutorStats();
+
   return returnFromHighs(return_status);
 }
 
+void Highs::reportTaskExecutorStats() {
+  const std::vector<HighsSplitDeque::WorkerStats> stats =
+      HighsTaskExecutor::getWorkerStats();
+  if (stats.size() <= 1) return;
+  HighsLogOptions& log_options = options_.log_options;
+  highsLogUser(log_options, HighsLogType::kInfo,
+               "Task scheduler statistics\n"
+               "Worker   Tasks run  Tasks stolen  Failed steals  Overflow  "
+               "Steal loop (s)  Parked (s)  Wake-ups  Latency (us)  Spin "
+               "(us)\n");
+  for (size_t iWorker = 0; iWorker < stats.size(); iWorker++) {
+    const HighsSplitDeque::WorkerStats& worker = stats[iWorker];
+    const double average_latency =
+        worker.numWakeups ? 1e6 * worker.wakeupLatency / worker.numWakeups
+                          : 0;
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "%6d  %10" PRIu64 "  %12" PRIu64 "  %13" PRIu64 "  %8" PRIu64
+                 "  %14.3f  %10.3f  %8" PRIu64 "  %12.1f  %9d\n",
+                 (int)iWorker, worker.numTasksRun, worker.numTasksStolen,
+                 worker.numFailedSteals, worker.numOverflowTasks,
+                 worker.stealLoopTime, worker.parkedTime, worker.numWakeups,
+                 average_latency, worker.spinMicroSecs);
+  }
+}
+
 HighsStatus Highs::returnFromHighs(HighsStatus highs_return_status) {
   // Applies checks before returning from HiGHS
   HighsStatus return_status = highs_return_status;
@@ -4067,3 +4357,117 @@ HighsStatus Highs::openLogFile(const std::string& log_file) {
 void Highs::resetGlobalScheduler(bool blocking) {
   HighsTaskExecutor::shutdown(blocking);
 }
+
+std::shared_ptr<HighsTaskExecutor::ExecutorHandle> Highs::createTaskExecutor(
+    const HighsInt num_threads, const HighsSchedulerConfig& config) {
+  if (num_threads < 0) return nullptr;
+  const int use_num_threads =
+      num_threads > 0 ? (int)num_threads
+                      : (int)(std::thread::hardware_concurrency() + 1) / 2;
+  return HighsTaskExecutor::createExecutor(
+      std::max(use_num_threads, 1), config);
+}
+
+HighsStatus Highs::solveBatch(const std::vector<HighsModel>& models,
+                              std::vector<HighsBatchResult>& results) {
+  const HighsInt num_model = models.size();
+  results.assign(num_model, HighsBatchResult());
+  if (num_model == 0) return HighsStatus::kOk;
+
+  HighsTaskExecutor::ScopedBinding executor_binding(task_executor_);
+  highs::parallel::initialize_scheduler(options_.threads,
+                                        schedulerConfig(options_));
+  const HighsInt num_threads = highs::parallel::num_threads();
+  if (!task_executor_ && options_.threads != 0 &&
+      num_threads != options_.threads) {
+    highsLogUser(
+        options_.log_options, HighsLogType::kError,
+        "Option 'threads' is set to %d but global scheduler has already been "
+        "initialized to use %d threads. The previous scheduler instance can "
+        "be destroyed by calling Highs::resetGlobalScheduler().\n",
+        (int)options_.threads, (int)num_threads);
+    return HighsStatus::kError;
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Solving a batch of %d models with %d thread(s)\n",
+               (int)num_model, (int)num_threads);
+  // Events are traced for the whole batch, rather than by the solves
+  HighsTraceFile trace_file(options_.trace_file, options_.log_options);
+
+  // A worker that is waiting for the tasks of one solve may run the
+  // task for another model, so solver instances can't be associated
+  // with threads, and are taken from a pool instead
+  std::vector<std::unique_ptr<Highs>> pool;
+  std::mutex pool_mutex;
+  auto solveModel = [&](HighsInt iModel) {
+    std::unique_ptr<Highs> highs;
+    {
+      std::lock_guard<std::mutex> lock(pool_mutex);
+      if (!pool.empty()) {
+        highs = std::move(pool.back());
+        pool.pop_back();
+      }
+    }
+    if (!highs) {
+      highs.reset(new Highs());
+      highs->passOptions(options_);
+      highs->setOptionValue("output_flag", false);
+      highs->setOptionValue("trace_file", "");
+      // The executor has been checked, and is the one that the
+      // instance will use
+      highs->setOptionValue("threads", 0);
+      // Solves by all the instances in the pool draw on the vectors
+      // that this instance has already grown
+      highs->setSimplexWorkspace(getSimplexWorkspace());
+    }
+    HighsBatchResult& result = results[iModel];
+    result.run_status = highs->passModel(models[iModel]);
+    if (result.run_status != HighsStatus::kError)
+      result.run_status = highs->run();
+    result.model_status = highs->getModelStatus();
+    result.info = highs->getInfo();
+    result.solution = highs->getSolution();
+    result.basis = highs->getBasis();
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    pool.push_back(std::move(highs));
+  };
+  if (num_threads > 1) {
+    highs::parallel::for_each(0, num_model, [&](HighsInt from, HighsInt to) {
+      for (HighsInt iModel = from; iModel < to; iModel++) solveModel(iModel);
+    });
+  } else {
+    for (HighsInt iModel = 0; iModel < num_model; iModel++)
+      solveModel(iModel);
+  }
+
+  HighsStatus return_status = HighsStatus::kOk;
+  for (const HighsBatchResult& result : results)
+    return_status = worseStatus(result.run_status, return_status);
+  return return_status;
+}
+
+HighsSchedulerConfig Highs::schedulerConfig(const HighsOptions& options) {
+  HighsSchedulerConfig config;
+  config.pinThreads = options.thread_affinity;
+  config.localityAwareStealing = options.numa_aware_stealing;
+  config.idlePolicy = HighsIdlePolicy(options.idle_policy);
+  config.maxSpinMicroSecs = options.idle_spin_microseconds;
+  return config;
+}
+
+void Highs::setSimplexWorkspace(
+    std::shared_ptr<HighsSimplexWorkspace> workspace) {
+  if (!workspace) workspace = std::make_shared<HighsSimplexWorkspace>();
+  ekk_instance_.workspace_ = std::move(workspace);
+}
+
+HighsStatus Highs::setTaskExecutor(
+    std::shared_ptr<HighsTaskExecutor::ExecutorHandle> task_executor) {
+  if (task_executor && !task_executor->ptr) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Task executor has been shut down\n");
+    return HighsStatus::kError;
+  }
+  task_executor_ = std::move(task_executor);
+  return HighsStatus::kOk;
+}
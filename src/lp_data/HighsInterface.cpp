@@ -326,6 +326,7 @@ void Highs::deleteColsInterface(HighsIndexCollection& index_collection) {
     // the Highs basis
     model_status_ = HighsModelStatus::kNotset;
     basis.valid = false;
+    mip_root_basis_.invalidate();
   }
   if (lp.scale_.has_scaling) {
     deleteScale(lp.scale_.col, index_collection);
@@ -353,7 +354,7 @@ void Highs::deleteColsInterface(HighsIndexCollection& index_collection) {
     assert(new_col == lp.num_col_);
   }
   assert(lpDimensionsOk("deleteCols", lp, options_.log_options));
-  lp.col_hash_.name2index.clear();
+  lp.col_hash_.clear();
 }
 
 void Highs::deleteRowsInterface(HighsIndexCollection& index_collection) {
@@ -371,6 +372,8 @@ void Highs::deleteRowsInterface(HighsIndexCollection& index_collection) {
     // the Highs basis
     model_status_ = HighsModelStatus::kNotset;
     basis.valid = false;
+    mip_root_basis_.invalidate();
+    mip_root_row_dual_.clear();
   }
   if (lp.scale_.has_scaling) {
     deleteScale(lp.scale_.row, index_collection);
@@ -395,7 +398,7 @@ void Highs::deleteRowsInterface(HighsIndexCollection& index_collection) {
     assert(new_row == lp.num_row_);
   }
   assert(lpDimensionsOk("deleteRows", lp, options_.log_options));
-  lp.row_hash_.name2index.clear();
+  lp.row_hash_.clear();
 }
 
 void Highs::getColsInterface(const HighsIndexCollection& index_collection,
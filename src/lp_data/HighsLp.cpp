@@ -13,8 +13,10 @@
  */
 #include "lp_data/HighsLp.h"
 
+#include <algorithm>
 #include <cassert>
 
+#include "util/HighsHash.h"
 #include "util/HighsMatrixUtils.h"
 
 bool HighsLp::isMip() const {
@@ -262,8 +264,7 @@ void HighsLp::addColNames(const std::string name, const HighsInt num_new_col) {
   if (this->num_col_ == 0) return;
   HighsInt col_names_size = this->col_names_.size();
   if (col_names_size < this->num_col_) return;
-  if (!this->col_hash_.name2index.size())
-    this->col_hash_.form(this->col_names_);
+  if (!this->col_hash_.size()) this->col_hash_.form(this->col_names_);
   // Handle the addition of user-defined names later
   assert(name == "");
   for (HighsInt iCol = this->num_col_; iCol < this->num_col_ + num_new_col;
@@ -271,8 +272,7 @@ void HighsLp::addColNames(const std::string name, const HighsInt num_new_col) {
     const std::string col_name =
         "col_ekk_" + std::to_string(this->new_col_name_ix_++);
     bool added = false;
-    auto search = this->col_hash_.name2index.find(col_name);
-    if (search == this->col_hash_.name2index.end()) {
+    if (this->col_hash_.find(this->col_names_, col_name) == kHashNotFound) {
       // Name not found in hash
       if (col_names_size == this->num_col_) {
         // No space (or name) for this col name
@@ -287,14 +287,13 @@ void HighsLp::addColNames(const std::string name, const HighsInt num_new_col) {
       }
     }
     if (added) {
-      const bool duplicate =
-          !this->col_hash_.name2index.emplace(col_name, iCol).second;
+      const bool duplicate = !this->col_hash_.insert(this->col_names_, iCol);
       assert(!duplicate);
       assert(this->col_names_[iCol] == col_name);
-      assert(this->col_hash_.name2index.find(col_name)->second == iCol);
+      assert(this->col_hash_.find(this->col_names_, col_name) == iCol);
     } else {
       // Duplicate name or other failure
-      this->col_hash_.name2index.clear();
+      this->col_hash_.clear();
       return;
     }
   }
@@ -306,8 +305,7 @@ void HighsLp::addRowNames(const std::string name, const HighsInt num_new_row) {
   if (this->num_row_ == 0) return;
   HighsInt row_names_size = this->row_names_.size();
   if (row_names_size < this->num_row_) return;
-  if (!this->row_hash_.name2index.size())
-    this->row_hash_.form(this->row_names_);
+  if (!this->row_hash_.size()) this->row_hash_.form(this->row_names_);
   // Handle the addition of user-defined names later
   assert(name == "");
   for (HighsInt iRow = this->num_row_; iRow < this->num_row_ + num_new_row;
@@ -315,8 +313,7 @@ void HighsLp::addRowNames(const std::string name, const HighsInt num_new_row) {
     const std::string row_name =
         "row_ekk_" + std::to_string(this->new_row_name_ix_++);
     bool added = false;
-    auto search = this->row_hash_.name2index.find(row_name);
-    if (search == this->row_hash_.name2index.end()) {
+    if (this->row_hash_.find(this->row_names_, row_name) == kHashNotFound) {
       // Name not found in hash
       if (row_names_size == this->num_row_) {
         // No space (or name) for this row name
@@ -331,14 +328,13 @@ void HighsLp::addRowNames(const std::string name, const HighsInt num_new_row) {
       }
     }
     if (added) {
-      const bool duplicate =
-          !this->row_hash_.name2index.emplace(row_name, iRow).second;
+      const bool duplicate = !this->row_hash_.insert(this->row_names_, iRow);
       assert(!duplicate);
       assert(this->row_names_[iRow] == row_name);
-      assert(this->row_hash_.name2index.find(row_name)->second == iRow);
+      assert(this->row_hash_.find(this->row_names_, row_name) == iRow);
     } else {
       // Duplicate name or other failure
-      this->row_hash_.name2index.clear();
+      this->row_hash_.clear();
       return;
     }
   }
@@ -442,20 +438,18 @@ bool HighsLpMods::isClear() {
   return true;
 }
 
+// Slot entries other than kNameHashEmptySlot are the position of a
+// name, or -2 - position for a name that is duplicated
+const HighsInt kNameHashEmptySlot = -1;
+
+static uint32_t nameHash(const std::string& name) {
+  return HighsHashHelpers::vector_hash(name.data(), name.size()) >> 32;
+}
+
 void HighsNameHash::form(const std::vector<std::string>& name) {
   size_t num_name = name.size();
   this->clear();
-  for (size_t index = 0; index < num_name; index++) {
-    const bool duplicate = !this->name2index.emplace(name[index], index).second;
-    if (duplicate) {
-      // Find the original and mark it as duplicate
-      auto search = this->name2index.find(name[index]);
-      assert(search != this->name2index.end());
-      assert(int(search->second) < int(this->name2index.size()));
-      this->name2index.erase(search);
-      this->name2index.insert({name[index], kHashIsDuplicate});
-    }
-  }
+  for (size_t index = 0; index < num_name; index++) this->insert(name, index);
 }
 
 bool HighsNameHash::hasDuplicate(const std::vector<std::string>& name) {
@@ -463,11 +457,67 @@ bool HighsNameHash::hasDuplicate(const std::vector<std::string>& name) {
   this->clear();
   bool has_duplicate = false;
   for (size_t index = 0; index < num_name; index++) {
-    has_duplicate = !this->name2index.emplace(name[index], index).second;
+    has_duplicate = !this->insert(name, index);
     if (has_duplicate) break;
   }
   this->clear();
   return has_duplicate;
 }
 
-void HighsNameHash::clear() { this->name2index.clear(); }
+HighsInt HighsNameHash::find(const std::vector<std::string>& name,
+                             const std::string& key) const {
+  if (this->slot.empty()) return kHashNotFound;
+  const uint32_t hash = nameHash(key);
+  const size_t mask = this->slot.size() - 1;
+  for (size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+    const Slot& s = this->slot[pos];
+    if (s.entry == kNameHashEmptySlot) return kHashNotFound;
+    if (s.hash != hash) continue;
+    const bool duplicate = s.entry < kNameHashEmptySlot;
+    const HighsInt index = duplicate ? -2 - s.entry : s.entry;
+    if (index >= HighsInt(name.size())) continue;
+    if (name[index] == key) return duplicate ? kHashIsDuplicate : index;
+  }
+}
+
+bool HighsNameHash::insert(const std::vector<std::string>& name,
+                           const HighsInt index) {
+  // Keep the load factor at most 1/2, so probe sequences are short
+  if (2 * (this->num_entry + 1) > HighsInt(this->slot.size())) {
+    std::vector<Slot> old_slot = std::move(this->slot);
+    this->slot.assign(std::max(size_t{16}, 2 * old_slot.size()),
+                      Slot{0, kNameHashEmptySlot});
+    const size_t mask = this->slot.size() - 1;
+    for (const Slot& s : old_slot) {
+      if (s.entry == kNameHashEmptySlot) continue;
+      size_t pos = s.hash & mask;
+      while (this->slot[pos].entry != kNameHashEmptySlot)
+        pos = (pos + 1) & mask;
+      this->slot[pos] = s;
+    }
+  }
+  const std::string& key = name[index];
+  const uint32_t hash = nameHash(key);
+  const size_t mask = this->slot.size() - 1;
+  size_t pos = hash & mask;
+  for (;; pos = (pos + 1) & mask) {
+    Slot& s = this->slot[pos];
+    if (s.entry == kNameHashEmptySlot) break;
+    if (s.hash != hash) continue;
+    const bool duplicate = s.entry < kNameHashEmptySlot;
+    const HighsInt original = duplicate ? -2 - s.entry : s.entry;
+    if (name[original] == key) {
+      // Mark the original as duplicate
+      if (!duplicate) s.entry = -2 - original;
+      return false;
+    }
+  }
+  this->slot[pos] = Slot{hash, index};
+  this->num_entry++;
+  return true;
+}
+
+void HighsNameHash::clear() {
+  this->slot.clear();
+  this->num_entry = 0;
+}
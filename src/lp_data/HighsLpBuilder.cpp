@@ -0,0 +1,247 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsLpBuilder.cpp
+ * @brief
+ */
+#include "lp_data/HighsLpBuilder.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "parallel/HighsParallel.h"
+
+// Starts for a set of vectors with num_nz entries must be
+// nondecreasing, beginning at zero and ending at most at num_nz
+static bool startsOk(const HighsInt num_vec, const HighsInt num_nz,
+                     const HighsInt* start) {
+  if (num_nz == 0) return true;
+  if (start[0] != 0) return false;
+  for (HighsInt iVec = 1; iVec < num_vec; iVec++)
+    if (start[iVec] < start[iVec - 1] || start[iVec] > num_nz) return false;
+  return true;
+}
+
+void HighsLpBuilder::reserve(const HighsInt num_col, const HighsInt num_row,
+                             const HighsInt num_nz) {
+  if (num_col > 0) {
+    lp_.col_cost_.reserve(num_col);
+    lp_.col_lower_.reserve(num_col);
+    lp_.col_upper_.reserve(num_col);
+    lp_.a_matrix_.start_.reserve(num_col + 1);
+  }
+  if (num_row > 0) {
+    lp_.row_lower_.reserve(num_row);
+    lp_.row_upper_.reserve(num_row);
+  }
+  if (num_nz > 0) {
+    lp_.a_matrix_.index_.reserve(num_nz);
+    lp_.a_matrix_.value_.reserve(num_nz);
+  }
+}
+
+HighsLp& HighsLpBuilder::allocate(const HighsInt num_col,
+                                  const HighsInt num_row,
+                                  const HighsInt num_nz) {
+  clear();
+  lp_.num_col_ = std::max(num_col, HighsInt{0});
+  lp_.num_row_ = std::max(num_row, HighsInt{0});
+  lp_.col_cost_.resize(lp_.num_col_);
+  lp_.col_lower_.resize(lp_.num_col_);
+  lp_.col_upper_.resize(lp_.num_col_);
+  lp_.row_lower_.resize(lp_.num_row_);
+  lp_.row_upper_.resize(lp_.num_row_);
+  HighsSparseMatrix& matrix = lp_.a_matrix_;
+  matrix.start_.assign(lp_.num_col_ + 1, 0);
+  matrix.start_[lp_.num_col_] = std::max(num_nz, HighsInt{0});
+  matrix.index_.resize(matrix.start_[lp_.num_col_]);
+  matrix.value_.resize(matrix.start_[lp_.num_col_]);
+  return lp_;
+}
+
+HighsStatus HighsLpBuilder::addCols(const HighsInt num_new_col,
+                                    const double* cost, const double* lower,
+                                    const double* upper,
+                                    const HighsInt num_new_nz,
+                                    const HighsInt* start,
+                                    const HighsInt* index,
+                                    const double* value) {
+  if (num_new_col < 0 || num_new_nz < 0) return HighsStatus::kError;
+  if (num_new_col == 0) return HighsStatus::kOk;
+  if (cost == nullptr || lower == nullptr || upper == nullptr)
+    return HighsStatus::kError;
+  if (num_new_nz > 0 &&
+      (start == nullptr || index == nullptr || value == nullptr))
+    return HighsStatus::kError;
+  if (!startsOk(num_new_col, num_new_nz, start)) return HighsStatus::kError;
+  HighsSparseMatrix& matrix = lp_.a_matrix_;
+  const HighsInt from_el = matrix.index_.size();
+  for (HighsInt iCol = 1; iCol < num_new_col; iCol++)
+    matrix.start_.push_back(from_el + (num_new_nz > 0 ? start[iCol] : 0));
+  matrix.start_.push_back(from_el + num_new_nz);
+  matrix.index_.insert(matrix.index_.end(), index, index + num_new_nz);
+  matrix.value_.insert(matrix.value_.end(), value, value + num_new_nz);
+  lp_.col_cost_.insert(lp_.col_cost_.end(), cost, cost + num_new_col);
+  lp_.col_lower_.insert(lp_.col_lower_.end(), lower, lower + num_new_col);
+  lp_.col_upper_.insert(lp_.col_upper_.end(), upper, upper + num_new_col);
+  lp_.num_col_ += num_new_col;
+  if (!lp_.integrality_.empty())
+    lp_.integrality_.resize(lp_.num_col_, HighsVarType::kContinuous);
+  return HighsStatus::kOk;
+}
+
+HighsStatus HighsLpBuilder::addCol(const double cost, const double lower,
+                                   const double upper,
+                                   const HighsInt num_new_nz,
+                                   const HighsInt* index,
+                                   const double* value) {
+  const HighsInt start = 0;
+  return addCols(1, &cost, &lower, &upper, num_new_nz, &start, index, value);
+}
+
+HighsStatus HighsLpBuilder::addRows(const HighsInt num_new_row,
+                                    const double* lower, const double* upper,
+                                    const HighsInt num_new_nz,
+                                    const HighsInt* start,
+                                    const HighsInt* index,
+                                    const double* value) {
+  if (num_new_row < 0 || num_new_nz < 0) return HighsStatus::kError;
+  if (num_new_row == 0) return HighsStatus::kOk;
+  if (lower == nullptr || upper == nullptr) return HighsStatus::kError;
+  if (num_new_nz > 0 &&
+      (start == nullptr || index == nullptr || value == nullptr))
+    return HighsStatus::kError;
+  if (!startsOk(num_new_row, num_new_nz, start)) return HighsStatus::kError;
+  entry_row_.reserve(entry_row_.size() + num_new_nz);
+  for (HighsInt iRow = 0; iRow < num_new_row; iRow++) {
+    const HighsInt row_start = num_new_nz > 0 ? start[iRow] : 0;
+    const HighsInt row_end = iRow + 1 < num_new_row && num_new_nz > 0
+                                 ? start[iRow + 1]
+                                 : num_new_nz;
+    entry_row_.insert(entry_row_.end(), row_end - row_start,
+                      lp_.num_row_ + iRow);
+  }
+  entry_col_.insert(entry_col_.end(), index, index + num_new_nz);
+  entry_value_.insert(entry_value_.end(), value, value + num_new_nz);
+  lp_.row_lower_.insert(lp_.row_lower_.end(), lower, lower + num_new_row);
+  lp_.row_upper_.insert(lp_.row_upper_.end(), upper, upper + num_new_row);
+  lp_.num_row_ += num_new_row;
+  return HighsStatus::kOk;
+}
+
+HighsStatus HighsLpBuilder::addRow(const double lower, const double upper,
+                                   const HighsInt num_new_nz,
+                                   const HighsInt* index,
+                                   const double* value) {
+  const HighsInt start = 0;
+  return addRows(1, &lower, &upper, num_new_nz, &start, index, value);
+}
+
+HighsStatus HighsLpBuilder::addEntries(const HighsInt num_new_nz,
+                                       const HighsInt* row,
+                                       const HighsInt* col,
+                                       const double* value) {
+  if (num_new_nz < 0) return HighsStatus::kError;
+  if (num_new_nz == 0) return HighsStatus::kOk;
+  if (row == nullptr || col == nullptr || value == nullptr)
+    return HighsStatus::kError;
+  entry_row_.insert(entry_row_.end(), row, row + num_new_nz);
+  entry_col_.insert(entry_col_.end(), col, col + num_new_nz);
+  entry_value_.insert(entry_value_.end(), value, value + num_new_nz);
+  return HighsStatus::kOk;
+}
+
+HighsStatus HighsLpBuilder::setIntegrality(const HighsInt col,
+                                           const HighsVarType integrality) {
+  if (col < 0 || col >= lp_.num_col_) return HighsStatus::kError;
+  if (lp_.integrality_.empty())
+    lp_.integrality_.assign(lp_.num_col_, HighsVarType::kContinuous);
+  lp_.integrality_[col] = integrality;
+  return HighsStatus::kOk;
+}
+
+HighsStatus HighsLpBuilder::finalise(HighsLp& lp) {
+  const HighsInt num_col = lp_.num_col_;
+  const HighsInt num_row = lp_.num_row_;
+  HighsSparseMatrix& matrix = lp_.a_matrix_;
+  assert(HighsInt(matrix.start_.size()) == num_col + 1);
+  if (matrix.start_[0] != 0) return HighsStatus::kError;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    if (matrix.start_[iCol + 1] < matrix.start_[iCol])
+      return HighsStatus::kError;
+  if (matrix.start_[num_col] != HighsInt(matrix.index_.size()))
+    return HighsStatus::kError;
+  for (const HighsInt iRow : matrix.index_)
+    if (iRow < 0 || iRow >= num_row) return HighsStatus::kError;
+  const HighsInt num_entry = entry_value_.size();
+  for (HighsInt iEl = 0; iEl < num_entry; iEl++) {
+    if (entry_row_[iEl] < 0 || entry_row_[iEl] >= num_row ||
+        entry_col_[iEl] < 0 || entry_col_[iEl] >= num_col)
+      return HighsStatus::kError;
+  }
+  if (num_entry > 0) {
+    // Merge the entries into the column-wise matrix: each column
+    // holds its column-wise entries followed by its other entries in
+    // the order in which they were added
+    std::vector<HighsInt> start(num_col + 1);
+    start[0] = 0;
+    std::vector<HighsInt> entry_count(num_col, 0);
+    for (HighsInt iEl = 0; iEl < num_entry; iEl++)
+      entry_count[entry_col_[iEl]]++;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      start[iCol + 1] = start[iCol] + matrix.start_[iCol + 1] -
+                        matrix.start_[iCol] + entry_count[iCol];
+    const HighsInt num_nz = start[num_col];
+    std::vector<HighsInt> index(num_nz);
+    std::vector<double> value(num_nz);
+    // Copying the column-wise entries is independent across columns
+    auto copyCols = [&](HighsInt from_col, HighsInt to_col) {
+      for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+        HighsInt to_el = start[iCol];
+        for (HighsInt iEl = matrix.start_[iCol]; iEl < matrix.start_[iCol + 1];
+             iEl++) {
+          index[to_el] = matrix.index_[iEl];
+          value[to_el] = matrix.value_[iEl];
+          to_el++;
+        }
+        // Point entry_count at the position for the column's other
+        // entries
+        entry_count[iCol] = to_el;
+      }
+    };
+    if (HighsTaskExecutor::isInitialized() &&
+        highs::parallel::num_threads() > 1) {
+      highs::parallel::for_each(0, num_col, copyCols, 1024);
+    } else {
+      copyCols(0, num_col);
+    }
+    for (HighsInt iEl = 0; iEl < num_entry; iEl++) {
+      const HighsInt to_el = entry_count[entry_col_[iEl]]++;
+      index[to_el] = entry_row_[iEl];
+      value[to_el] = entry_value_[iEl];
+    }
+    matrix.start_ = std::move(start);
+    matrix.index_ = std::move(index);
+    matrix.value_ = std::move(value);
+  }
+  matrix.format_ = MatrixFormat::kColwise;
+  matrix.num_col_ = num_col;
+  matrix.num_row_ = num_row;
+  lp = std::move(lp_);
+  clear();
+  return HighsStatus::kOk;
+}
+
+void HighsLpBuilder::clear() {
+  lp_.clear();
+  entry_row_.clear();
+  entry_col_.clear();
+  entry_value_.clear();
+}
@@ -0,0 +1,105 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsLpBuilder.h
+ * @brief Incremental construction of a HighsLp
+ *
+ * Columns, rows and matrix entries can be added in any order and in
+ * any number of calls. Entries given with columns are held
+ * column-wise as they arrive; entries given with rows or as triplets
+ * are held separately and merged in by a single counting sort when
+ * the LP is finalised. If all entries come with their columns, the
+ * column-wise storage becomes the constraint matrix without being
+ * copied.
+ */
+#ifndef LP_DATA_HIGHS_LP_BUILDER_H_
+#define LP_DATA_HIGHS_LP_BUILDER_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "lp_data/HighsStatus.h"
+
+class HighsLpBuilder {
+ public:
+  HighsLpBuilder() { clear(); }
+
+  // Reserve space for the given totals, avoiding reallocation as
+  // data are added
+  void reserve(const HighsInt num_col, const HighsInt num_row,
+               const HighsInt num_nz);
+
+  // Discard any data that have been added, and size the LP for the
+  // given dimensions. Its costs, bounds and column-wise matrix can
+  // then be written directly into the arrays of the LP that is
+  // returned, the first num_col matrix starts being set by the
+  // caller. When the LP is finalised, these arrays become those of
+  // the LP without being copied
+  HighsLp& allocate(const HighsInt num_col, const HighsInt num_row,
+                    const HighsInt num_nz);
+
+  // Add columns with (optional) column-wise entries, as for
+  // Highs::addCols. Row indices may refer to rows that are yet to be
+  // added
+  HighsStatus addCols(const HighsInt num_new_col, const double* cost,
+                      const double* lower, const double* upper,
+                      const HighsInt num_new_nz = 0,
+                      const HighsInt* start = nullptr,
+                      const HighsInt* index = nullptr,
+                      const double* value = nullptr);
+  HighsStatus addCol(const double cost, const double lower,
+                     const double upper, const HighsInt num_new_nz = 0,
+                     const HighsInt* index = nullptr,
+                     const double* value = nullptr);
+
+  // Add rows with (optional) row-wise entries, as for
+  // Highs::addRows. Column indices may refer to columns that are yet
+  // to be added
+  HighsStatus addRows(const HighsInt num_new_row, const double* lower,
+                      const double* upper, const HighsInt num_new_nz = 0,
+                      const HighsInt* start = nullptr,
+                      const HighsInt* index = nullptr,
+                      const double* value = nullptr);
+  HighsStatus addRow(const double lower, const double upper,
+                     const HighsInt num_new_nz = 0,
+                     const HighsInt* index = nullptr,
+                     const double* value = nullptr);
+
+  // Add matrix entries as (row, col, value) triplets
+  HighsStatus addEntries(const HighsInt num_new_nz, const HighsInt* row,
+                         const HighsInt* col, const double* value);
+
+  HighsStatus setIntegrality(const HighsInt col,
+                             const HighsVarType integrality);
+  void setObjectiveSense(const ObjSense sense) { lp_.sense_ = sense; }
+  void setObjectiveOffset(const double offset) { lp_.offset_ = offset; }
+
+  HighsInt getNumCol() const { return lp_.num_col_; }
+  HighsInt getNumRow() const { return lp_.num_row_; }
+  HighsInt getNumNz() const {
+    return HighsInt(lp_.a_matrix_.index_.size() + entry_value_.size());
+  }
+
+  // Move the data into lp, leaving the builder empty. Returns
+  // kError if the matrix starts are not consistent, or any entry
+  // refers to a row or column that has not been added
+  HighsStatus finalise(HighsLp& lp);
+
+  void clear();
+
+ private:
+  HighsLp lp_;
+  // Entries that were not given with their columns
+  std::vector<HighsInt> entry_row_;
+  std::vector<HighsInt> entry_col_;
+  std::vector<double> entry_value_;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsSolution.h"
 #include "lp_data/HighsStatus.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
@@ -34,6 +35,23 @@ using std::min;
 
 const HighsInt kMaxLineLength = 80;
 
+// Number of costs or bounds in an interval for which they are
+// assessed in parallel
+const HighsInt kParallelAssessMinDim = 1 << 16;
+
+static bool assessInParallel(const HighsIndexCollection& index_collection,
+                             const HighsInt from_k, const HighsInt to_k) {
+  return index_collection.is_interval_ &&
+         to_k + 1 - from_k >= kParallelAssessMinDim &&
+         HighsTaskExecutor::isInitialized() &&
+         highs::parallel::num_threads() > 1;
+}
+
+static HighsInt assessGrainSize(const HighsInt num_k) {
+  return std::max(HighsInt{1024},
+                  num_k / (16 * highs::parallel::num_threads()));
+}
+
 HighsStatus assessLp(HighsLp& lp, const HighsOptions& options) {
   HighsStatus return_status = HighsStatus::kOk;
   HighsStatus call_status = lpDimensionsOk("assessLp", lp, options.log_options)
@@ -311,6 +329,34 @@ HighsStatus assessCosts(const HighsOptions& options, const HighsInt ml_col_os,
   HighsInt local_col;
   HighsInt usr_col = -1;
   HighsInt num_infinite_cost = 0;
+  if (assessInParallel(index_collection, from_k, to_k)) {
+    // For an interval, usr_col is k - from_k, so entries can be
+    // assessed independently
+    std::vector<HighsInt> thread_num_infinite_cost(
+        highs::parallel::num_threads(), 0);
+    highs::parallel::for_each(
+        from_k, to_k + 1,
+        [&](HighsInt from_range, HighsInt to_range) {
+          HighsInt num_infinite = 0;
+          for (HighsInt k = from_range; k < to_range; k++) {
+            double& value = cost[k - from_k];
+            if (value >= infinite_cost) {
+              num_infinite++;
+              value = kHighsInf;
+            } else if (value <= -infinite_cost) {
+              num_infinite++;
+              value = -kHighsInf;
+            }
+          }
+          thread_num_infinite_cost[highs::parallel::thread_num()] +=
+              num_infinite;
+        },
+        assessGrainSize(to_k + 1 - from_k));
+    for (const HighsInt num_infinite : thread_num_infinite_cost)
+      num_infinite_cost += num_infinite;
+    // Skip the serial loop
+    to_k = from_k - 1;
+  }
   for (HighsInt k = from_k; k < to_k + 1; k++) {
     if (index_collection.is_interval_ || index_collection.is_mask_) {
       local_col = k;
@@ -386,6 +432,58 @@ HighsStatus assessBounds(const HighsOptions& options, const char* type,
   HighsInt local_ix;
   HighsInt ml_ix;
   HighsInt usr_ix = -1;
+  if (assessInParallel(index_collection, from_k, to_k)) {
+    // For an interval, usr_ix is k - from_k, so entries can be
+    // assessed independently. Bounds are treated as infinite in
+    // parallel, and the existence of inconsistent or illegal bounds
+    // recorded, in which case the serial loop reports them in order
+    struct BoundStats {
+      HighsInt num_infinite_lower_bound = 0;
+      HighsInt num_infinite_upper_bound = 0;
+      bool report = false;
+    };
+    std::vector<BoundStats> stats(highs::parallel::num_threads());
+    highs::parallel::for_each(
+        from_k, to_k + 1,
+        [&](HighsInt from_range, HighsInt to_range) {
+          BoundStats local;
+          for (HighsInt k = from_range; k < to_range; k++) {
+            const HighsInt ix = k - from_k;
+            if (!highs_isInfinity(-lower[ix]) && lower[ix] <= -infinite_bound) {
+              lower[ix] = -kHighsInf;
+              local.num_infinite_lower_bound++;
+            }
+            if (!highs_isInfinity(upper[ix]) && upper[ix] >= infinite_bound) {
+              upper[ix] = kHighsInf;
+              local.num_infinite_upper_bound++;
+            }
+            bool legal = lower[ix] < infinite_bound &&
+                         upper[ix] > -infinite_bound;
+            if (lower[ix] > upper[ix] &&
+                !(integrality &&
+                  (integrality[ix] == HighsVarType::kSemiContinuous ||
+                   integrality[ix] == HighsVarType::kSemiInteger)))
+              legal = false;
+            if (!legal) local.report = true;
+          }
+          BoundStats& thread_stats = stats[highs::parallel::thread_num()];
+          thread_stats.num_infinite_lower_bound +=
+              local.num_infinite_lower_bound;
+          thread_stats.num_infinite_upper_bound +=
+              local.num_infinite_upper_bound;
+          thread_stats.report = thread_stats.report || local.report;
+        },
+        assessGrainSize(to_k + 1 - from_k));
+    bool report = false;
+    for (const BoundStats& thread_stats : stats) {
+      num_infinite_lower_bound += thread_stats.num_infinite_lower_bound;
+      num_infinite_upper_bound += thread_stats.num_infinite_upper_bound;
+      report = report || thread_stats.report;
+    }
+    // Bounds already treated as infinite are not counted again by
+    // the serial loop, which is skipped if there is nothing to report
+    if (!report) to_k = from_k - 1;
+  }
   for (HighsInt k = from_k; k < to_k + 1; k++) {
     if (index_collection.is_interval_ || index_collection.is_mask_) {
       local_ix = k;
@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsMetrics.cpp
+ * @brief
+ */
+#include "lp_data/HighsMetrics.h"
+
+#include <chrono>
+
+#include "lp_data/HConst.h"
+
+void HighsMetrics::reset() {
+  run_start_.store(now(), std::memory_order_relaxed);
+  simplex_iteration_count_.store(0, std::memory_order_relaxed);
+  invert_count_.store(0, std::memory_order_relaxed);
+  invert_nanoseconds_.store(0, std::memory_order_relaxed);
+  for (HighsInt iBucket = 0; iBucket < kHighsMetricsNumDensityBucket;
+       iBucket++)
+    ftran_density_count_[iBucket].store(0, std::memory_order_relaxed);
+  mip_node_count_.store(0, std::memory_order_relaxed);
+  mip_open_node_count_.store(0, std::memory_order_relaxed);
+  mip_lp_iteration_count_.store(0, std::memory_order_relaxed);
+  mip_cut_pool_size_.store(0, std::memory_order_relaxed);
+  mip_primal_bound_.store(kHighsInf, std::memory_order_relaxed);
+  mip_dual_bound_.store(-kHighsInf, std::memory_order_relaxed);
+  mip_gap_.store(kHighsInf, std::memory_order_relaxed);
+}
+
+HighsMetricsSnapshot HighsMetrics::snapshot() const {
+  HighsMetricsSnapshot snapshot;
+  snapshot.run_time =
+      1e-9 * (now() - run_start_.load(std::memory_order_relaxed));
+  snapshot.simplex_iteration_count =
+      simplex_iteration_count_.load(std::memory_order_relaxed);
+  snapshot.invert_count = invert_count_.load(std::memory_order_relaxed);
+  snapshot.invert_time =
+      1e-9 * invert_nanoseconds_.load(std::memory_order_relaxed);
+  for (HighsInt iBucket = 0; iBucket < kHighsMetricsNumDensityBucket;
+       iBucket++)
+    snapshot.ftran_density_count[iBucket] =
+        ftran_density_count_[iBucket].load(std::memory_order_relaxed);
+  snapshot.mip_node_count = mip_node_count_.load(std::memory_order_relaxed);
+  snapshot.mip_open_node_count =
+      mip_open_node_count_.load(std::memory_order_relaxed);
+  snapshot.mip_lp_iteration_count =
+      mip_lp_iteration_count_.load(std::memory_order_relaxed);
+  snapshot.mip_cut_pool_size =
+      mip_cut_pool_size_.load(std::memory_order_relaxed);
+  snapshot.mip_primal_bound =
+      mip_primal_bound_.load(std::memory_order_relaxed);
+  snapshot.mip_dual_bound = mip_dual_bound_.load(std::memory_order_relaxed);
+  snapshot.mip_gap = mip_gap_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void HighsMetrics::recordFtranDensity(const double density) {
+  HighsInt iBucket = 0;
+  double bucket_lower = 0.1;
+  while (density < bucket_lower &&
+         iBucket < kHighsMetricsNumDensityBucket - 1) {
+    iBucket++;
+    bucket_lower *= 0.1;
+  }
+  ftran_density_count_[iBucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void HighsMetrics::recordMip(const int64_t node_count,
+                             const int64_t open_node_count,
+                             const int64_t lp_iteration_count,
+                             const int64_t cut_pool_size,
+                             const double primal_bound,
+                             const double dual_bound, const double gap) {
+  mip_node_count_.store(node_count, std::memory_order_relaxed);
+  mip_open_node_count_.store(open_node_count, std::memory_order_relaxed);
+  mip_lp_iteration_count_.store(lp_iteration_count,
+                                std::memory_order_relaxed);
+  mip_cut_pool_size_.store(cut_pool_size, std::memory_order_relaxed);
+  mip_primal_bound_.store(primal_bound, std::memory_order_relaxed);
+  mip_dual_bound_.store(dual_bound, std::memory_order_relaxed);
+  mip_gap_.store(gap, std::memory_order_relaxed);
+}
+
+int64_t HighsMetrics::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsMetrics.h
+ * @brief Live solver metrics that can be read during a solve
+ *
+ * HighsInfo is only complete once run() has returned. The values in
+ * HighsMetrics are updated by the solvers as they progress, and held
+ * in atomics, so another thread can take a snapshot at any time
+ * without blocking the solver. Values are updated with relaxed
+ * atomic operations, so a snapshot is not a consistent cut across
+ * all of them.
+ */
+#ifndef LP_DATA_HIGHSMETRICS_H_
+#define LP_DATA_HIGHSMETRICS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "util/HighsInt.h"
+
+// Number of buckets in the histogram of FTRAN result densities.
+// Bucket 0 counts densities of at least 0.1, bucket k counts
+// densities in [10^{-(k+1)}, 10^{-k}), and the last bucket counts all
+// smaller densities
+const HighsInt kHighsMetricsNumDensityBucket = 6;
+
+struct HighsMetricsSnapshot {
+  // Time since the start of the most recent run
+  double run_time;
+  int64_t simplex_iteration_count;
+  int64_t invert_count;
+  double invert_time;
+  int64_t ftran_density_count[kHighsMetricsNumDensityBucket];
+  int64_t mip_node_count;
+  int64_t mip_open_node_count;
+  int64_t mip_lp_iteration_count;
+  int64_t mip_cut_pool_size;
+  double mip_primal_bound;
+  double mip_dual_bound;
+  // Relative gap as a percentage, as in the MIP log
+  double mip_gap;
+};
+
+class HighsMetrics {
+ public:
+  HighsMetrics() { reset(); }
+
+  // Zero the metrics and start the run clock
+  void reset();
+
+  HighsMetricsSnapshot snapshot() const;
+
+  void recordSimplexIteration() {
+    simplex_iteration_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void recordInvert(const int64_t nanoseconds) {
+    invert_count_.fetch_add(1, std::memory_order_relaxed);
+    invert_nanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  }
+  void recordFtranDensity(const double density);
+  void recordMip(const int64_t node_count, const int64_t open_node_count,
+                 const int64_t lp_iteration_count, const int64_t cut_pool_size,
+                 const double primal_bound, const double dual_bound,
+                 const double gap);
+
+  static int64_t now();
+
+ private:
+  std::atomic<int64_t> run_start_;
+  std::atomic<int64_t> simplex_iteration_count_;
+  std::atomic<int64_t> invert_count_;
+  std::atomic<int64_t> invert_nanoseconds_;
+  std::atomic<int64_t> ftran_density_count_[kHighsMetricsNumDensityBucket];
+  std::atomic<int64_t> mip_node_count_;
+  std::atomic<int64_t> mip_open_node_count_;
+  std::atomic<int64_t> mip_lp_iteration_count_;
+  std::atomic<int64_t> mip_cut_pool_size_;
+  std::atomic<double> mip_primal_bound_;
+  std::atomic<double> mip_dual_bound_;
+  std::atomic<double> mip_gap_;
+};
+
+#endif /* LP_DATA_HIGHSMETRICS_H_ */
@@ -146,7 +146,6 @@ void writeModelBoundSolution(
   if (have_dual) assert((int)dual.size() >= dim);
   if (have_basis) assert((int)status.size() >= dim);
   const bool have_integrality = integrality != NULL;
-  std::string var_status_string;
   if (columns) {
     fprintf(file, "Columns\n");
   } else {
@@ -161,32 +160,36 @@ void writeModelBoundSolution(
   } else {
     fprintf(file, "\n");
   }
-  for (HighsInt ix = 0; ix < dim; ix++) {
-    if (have_basis) {
-      var_status_string = statusToString(status[ix], lower[ix], upper[ix]);
-    } else {
-      var_status_string = "";
-    }
-    fprintf(file, "%9" HIGHSINT_FORMAT "   %4s %12g %12g", ix,
-            var_status_string.c_str(), lower[ix], upper[ix]);
-    if (have_primal) {
-      fprintf(file, " %12g", primal[ix]);
-    } else {
-      fprintf(file, "             ");
-    }
-    if (have_dual) {
-      fprintf(file, " %12g", dual[ix]);
-    } else {
-      fprintf(file, "             ");
-    }
-    if (have_integrality)
-      fprintf(file, "  %s", typeToString(integrality[ix]).c_str());
-    if (have_names) {
-      fprintf(file, "  %-s\n", names[ix].c_str());
-    } else {
-      fprintf(file, "\n");
+  highsWriteChunked(file, dim, [&](HighsInt from, HighsInt to,
+                                   std::string& buffer) {
+    std::string var_status_string;
+    for (HighsInt ix = from; ix < to; ix++) {
+      if (have_basis) {
+        var_status_string = statusToString(status[ix], lower[ix], upper[ix]);
+      } else {
+        var_status_string = "";
+      }
+      highsAppendFormat(buffer, "%9" HIGHSINT_FORMAT "   %4s %12g %12g", ix,
+                        var_status_string.c_str(), lower[ix], upper[ix]);
+      if (have_primal) {
+        highsAppendFormat(buffer, " %12g", primal[ix]);
+      } else {
+        buffer += "             ";
+      }
+      if (have_dual) {
+        highsAppendFormat(buffer, " %12g", dual[ix]);
+      } else {
+        buffer += "             ";
+      }
+      if (have_integrality)
+        highsAppendFormat(buffer, "  %s", typeToString(integrality[ix]).c_str());
+      if (have_names) {
+        highsAppendFormat(buffer, "  %-s\n", names[ix].c_str());
+      } else {
+        buffer += "\n";
+      }
     }
-  }
+  });
 }
 
 void writeModelObjective(FILE* file, const HighsModel& model,
@@ -212,7 +215,6 @@ void writeObjectiveValue(FILE* file, const double objective_value) {
 void writePrimalSolution(FILE* file, const HighsLp& lp,
                          const std::vector<double>& primal_solution,
                          const bool sparse) {
-  std::stringstream ss;
   HighsInt num_nonzero_primal_value = 0;
   const bool have_col_names = lp.col_names_.size() > 0;
   if (sparse) {
@@ -225,18 +227,40 @@ void writePrimalSolution(FILE* file, const HighsLp& lp,
   // the negation of the number of nonzero values, if sparse
   fprintf(file, "# Columns %" HIGHSINT_FORMAT "\n",
           sparse ? -num_nonzero_primal_value : lp.num_col_);
-  for (HighsInt ix = 0; ix < lp.num_col_; ix++) {
-    if (sparse && !primal_solution[ix]) continue;
-    std::array<char, 32> valStr = highsDoubleToString(
-        primal_solution[ix], kHighsSolutionValueToStringTolerance);
-    // Create a column name
-    ss.str(std::string());
-    ss << "C" << ix;
-    const std::string name = have_col_names ? lp.col_names_[ix] : ss.str();
-    fprintf(file, "%-s %s", name.c_str(), valStr.data());
-    if (sparse) fprintf(file, " %d", int(ix));
-    fprintf(file, "\n");
-  }
+  highsWriteChunked(
+      file, lp.num_col_, [&](HighsInt from, HighsInt to, std::string& buffer) {
+        for (HighsInt ix = from; ix < to; ix++) {
+          if (sparse && !primal_solution[ix]) continue;
+          std::array<char, 32> valStr = highsDoubleToString(
+              primal_solution[ix], kHighsSolutionValueToStringTolerance);
+          // Create a column name
+          const std::string name = have_col_names
+                                       ? lp.col_names_[ix]
+                                       : "C" + std::to_string(ix);
+          highsAppendFormat(buffer, "%-s %s", name.c_str(), valStr.data());
+          if (sparse) highsAppendFormat(buffer, " %d", int(ix));
+          buffer += "\n";
+        }
+      });
+}
+
+// Write "name value" lines for a vector of solution values, using the
+// given prefix and index to create a name if there are none
+static void writeSolutionValues(FILE* file, const HighsInt dim,
+                                const std::vector<double>& value,
+                                const std::vector<std::string>& names,
+                                const char* prefix) {
+  const bool have_names = names.size() > 0;
+  highsWriteChunked(
+      file, dim, [&](HighsInt from, HighsInt to, std::string& buffer) {
+        for (HighsInt ix = from; ix < to; ix++) {
+          std::array<char, 32> valStr = highsDoubleToString(
+              value[ix], kHighsSolutionValueToStringTolerance);
+          const std::string name =
+              have_names ? names[ix] : prefix + std::to_string(ix);
+          highsAppendFormat(buffer, "%-s %s\n", name.c_str(), valStr.data());
+        }
+      });
 }
 void writeModelSolution(FILE* file, const HighsModel& model,
                         const HighsSolution& solution, const HighsInfo& info,
@@ -246,7 +270,6 @@ void writeModelSolution(FILE* file, const HighsModel& model,
   const bool have_row_names = lp.row_names_.size() > 0;
   const bool have_primal = solution.value_valid;
   const bool have_dual = solution.dual_valid;
-  std::stringstream ss;
   if (have_col_names) assert((int)lp.col_names_.size() >= lp.num_col_);
   if (have_row_names) assert((int)lp.row_names_.size() >= lp.num_row_);
   if (have_primal) {
@@ -273,15 +296,8 @@ void writeModelSolution(FILE* file, const HighsModel& model,
     writePrimalSolution(file, model.lp_, solution.col_value, sparse);
     if (sparse) return;
     fprintf(file, "# Rows %" HIGHSINT_FORMAT "\n", lp.num_row_);
-    for (HighsInt ix = 0; ix < lp.num_row_; ix++) {
-      std::array<char, 32> valStr = highsDoubleToString(
-          solution.row_value[ix], kHighsSolutionValueToStringTolerance);
-      // Create a row name
-      ss.str(std::string());
-      ss << "R" << ix;
-      const std::string name = have_row_names ? lp.row_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
-    }
+    writeSolutionValues(file, lp.num_row_, solution.row_value, lp.row_names_,
+                        "R");
   }
   fprintf(file, "\n# Dual solution values\n");
   if (!have_dual || info.dual_solution_status == kSolutionStatusNone) {
@@ -294,23 +310,11 @@ void writeModelSolution(FILE* file, const HighsModel& model,
       fprintf(file, "Infeasible\n");
     }
     fprintf(file, "# Columns %" HIGHSINT_FORMAT "\n", lp.num_col_);
-    for (HighsInt ix = 0; ix < lp.num_col_; ix++) {
-      std::array<char, 32> valStr = highsDoubleToString(
-          solution.col_dual[ix], kHighsSolutionValueToStringTolerance);
-      ss.str(std::string());
-      ss << "C" << ix;
-      const std::string name = have_col_names ? lp.col_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
-    }
+    writeSolutionValues(file, lp.num_col_, solution.col_dual, lp.col_names_,
+                        "C");
     fprintf(file, "# Rows %" HIGHSINT_FORMAT "\n", lp.num_row_);
-    for (HighsInt ix = 0; ix < lp.num_row_; ix++) {
-      std::array<char, 32> valStr = highsDoubleToString(
-          solution.row_dual[ix], kHighsSolutionValueToStringTolerance);
-      ss.str(std::string());
-      ss << "R" << ix;
-      const std::string name = have_row_names ? lp.row_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
-    }
+    writeSolutionValues(file, lp.num_row_, solution.row_dual, lp.row_names_,
+                        "R");
   }
 }
 
@@ -276,6 +276,10 @@ const string kRangingString = "ranging";
 const string kVersionString = "version";
 const string kWriteModelFileString = "write_model_file";
 const string kReadSolutionFileString = "read_solution_file";
+const string kPerfSuiteString = "perf_suite";
+const string kPerfReportString = "perf_report";
+const string kPerfRepeatString = "perf_repeat";
+const string kPerfCompareString = "perf_compare";
 
 // String for HiGHS log file option
 const string kLogFileString = "log_file";
@@ -303,8 +307,13 @@ struct HighsOptionsStruct {
   double objective_bound;
   double objective_target;
   HighsInt threads;
+  bool thread_affinity;
+  bool numa_aware_stealing;
+  HighsInt idle_policy;
+  HighsInt idle_spin_microseconds;
   HighsInt highs_debug_level;
   HighsInt highs_analysis_level;
+  std::string trace_file;
   HighsInt simplex_strategy;
   HighsInt simplex_scale_strategy;
   HighsInt simplex_crash_strategy;
@@ -336,6 +345,7 @@ struct HighsOptionsStruct {
   bool lp_presolve_requires_basis_postsolve;
   bool mps_parser_type_free;
   HighsInt keep_n_rows;
+  bool trust_hbin_model_file;
   HighsInt cost_scale_factor;
   HighsInt allowed_matrix_scale_factor;
   HighsInt allowed_cost_scale_factor;
@@ -379,6 +389,7 @@ struct HighsOptionsStruct {
 
   // Options for MIP solver
   bool mip_detect_symmetry;
+  double mip_symmetry_max_delay_fraction;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
   HighsInt mip_max_leaves;
@@ -388,6 +399,8 @@ struct HighsOptionsStruct {
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  HighsInt mip_probing_batch_size;
+  bool mip_root_warm_start;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
@@ -567,6 +580,37 @@ class HighsOptions : public HighsOptionsStruct {
         &threads, 0, 0, kHighsIInf);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "thread_affinity",
+        "Pin the threads used by HiGHS to CPUs, filling one NUMA node before "
+        "the next. Executors get different CPUs, and threads aren't pinned "
+        "if too few CPUs are left",
+        advanced, &thread_affinity, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "numa_aware_stealing",
+        "With thread_affinity, threads look for work on their own NUMA node "
+        "first",
+        advanced, &numa_aware_stealing, true);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "idle_policy",
+        "How idle threads wait for work: 0 => spin for up to "
+        "idle_spin_microseconds before sleeping; 1 => sleep at once; 2 => "
+        "adapt the time spent spinning to how soon work has recently "
+        "arrived",
+        advanced, &idle_policy, 0, 0, 2);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "idle_spin_microseconds",
+        "Longest time in microseconds for which an idle thread spins before "
+        "sleeping",
+        advanced, &idle_spin_microseconds, 0, 5000, 1000000);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt("highs_debug_level",
                                      "Debugging level in HiGHS", now_advanced,
                                      &highs_debug_level, kHighsDebugLevelMin,
@@ -579,6 +623,13 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsAnalysisLevelMax);
     records.push_back(record_int);
 
+    record_string = new OptionRecordString(
+        "trace_file",
+        "File for a Chrome trace of the computational components of each "
+        "run: not written for an empty string \"\"",
+        advanced, &trace_file, "");
+    records.push_back(record_string);
+
     record_int = new OptionRecordInt(
         "simplex_strategy",
         "Strategy for simplex solver 0 => Choose; 1 => Dual (serial); 2 => "
@@ -748,6 +799,14 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_detect_symmetry, true);
     records.push_back(record_bool);
 
+    record_double = new OptionRecordDouble(
+        "mip_symmetry_max_delay_fraction",
+        "Limit on the time by which MIP symmetry detection may delay the root "
+        "node, as a fraction of the time spent on the root node when it is "
+        "awaited",
+        advanced, &mip_symmetry_max_delay_fraction, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_int = new OptionRecordInt("mip_max_nodes",
                                      "MIP solver max number of nodes", advanced,
                                      &mip_max_nodes, 0, kHighsIInf, kHighsIInf);
@@ -834,6 +893,20 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_probing_batch_size",
+        "Number of binaries that MIP presolve probes in parallel on copies of "
+        "the domain before applying the results: 0 => probe sequentially",
+        advanced, &mip_probing_batch_size, 0, 0, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_root_warm_start",
+        "Whether the root LP basis and duals of a MIP solve are used to warm "
+        "start the next MIP solve of the (modified) model",
+        advanced, &mip_root_warm_start, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             now_advanced, &mip_report_level, 0, 1, 2);
@@ -923,6 +996,13 @@ class HighsOptions : public HighsOptionsStruct {
                             kKeepNRowsDeleteRows, kKeepNRowsKeepRows);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "trust_hbin_model_file",
+        "Skip the assessment of models read from .hbin files, which must "
+        "then have been written by HiGHS",
+        advanced, &trust_hbin_model_file, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("cost_scale_factor", "Scaling factor for costs",
                             advanced, &cost_scale_factor, -20, 0, 20);
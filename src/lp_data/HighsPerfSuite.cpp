@@ -0,0 +1,496 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsPerfSuite.cpp
+ * @brief
+ */
+#include "lp_data/HighsPerfSuite.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "Highs.h"
+#include "lp_data/HighsMetrics.h"
+#include "lp_data/HighsModelUtils.h"
+#include "util/stringutil.h"
+
+namespace {
+
+const std::vector<std::string> kPerfReportColumns = {
+    "model",
+    "repeat",
+    "model_status",
+    "objective_function_value",
+    "run_time",
+    "presolve_time",
+    "solve_time",
+    "postsolve_time",
+    "simplex_iteration_count",
+    "ipm_iteration_count",
+    "crossover_iteration_count",
+    "qp_iteration_count",
+    "mip_node_count",
+    "invert_count",
+    "invert_time",
+    "peak_memory_mb"};
+
+double peakMemoryMb() {
+#ifdef _WIN32
+  return -1;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+#ifdef __APPLE__
+  // ru_maxrss is in bytes on macOS, and kilobytes elsewhere
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+std::string directoryOf(const std::string& filename) {
+  const size_t slash = filename.find_last_of("/\\");
+  if (slash == std::string::npos) return "";
+  return filename.substr(0, slash + 1);
+}
+
+// The file name without its directory and extensions
+std::string modelName(const std::string& model_file) {
+  const size_t slash = model_file.find_last_of("/\\");
+  std::string name =
+      slash == std::string::npos ? model_file : model_file.substr(slash + 1);
+  const size_t dot = name.find('.');
+  if (dot != std::string::npos && dot > 0) name = name.substr(0, dot);
+  return name;
+}
+
+HighsPerfRecord solvePerfModel(const std::string& model_file,
+                               const HighsOptions& options, bool& ok) {
+  HighsPerfRecord record;
+  record.model = modelName(model_file);
+  Highs highs;
+  highs.passOptions(options);
+  highs.setOptionValue("output_flag", false);
+  ok = highs.readModel(model_file) != HighsStatus::kError &&
+       highs.run() != HighsStatus::kError;
+  if (!ok) return record;
+  const HighsInfo& info = highs.getInfo();
+  const HighsMetricsSnapshot metrics = highs.getMetrics()->snapshot();
+  record.model_status = highs.modelStatusToString(highs.getModelStatus());
+  record.objective_function_value = info.objective_function_value;
+  record.run_time = highs.getRunTime();
+  record.simplex_iteration_count = info.simplex_iteration_count;
+  record.ipm_iteration_count = info.ipm_iteration_count;
+  record.crossover_iteration_count = info.crossover_iteration_count;
+  record.qp_iteration_count = info.qp_iteration_count;
+  record.mip_node_count = info.mip_node_count;
+  // The MIP solver doesn't use the presolve, solve and postsolve
+  // timers, and the metrics are those of the last LP relaxation that
+  // was solved, so they are not recorded for a MIP
+  if (!highs.getLp().isMip()) {
+    record.presolve_time = highs.getPresolveTime();
+    record.solve_time = highs.getSolveTime();
+    record.postsolve_time = highs.getPostsolveTime();
+    record.invert_count = metrics.invert_count;
+    record.invert_time = metrics.invert_time;
+  }
+  record.peak_memory_mb = peakMemoryMb();
+  return record;
+}
+
+void writeOptionDeviations(FILE* file,
+                           const std::vector<OptionRecord*>& option_records) {
+  for (const OptionRecord* record : option_records) {
+    std::string value;
+    if (record->type == HighsOptionType::kBool) {
+      const OptionRecordBool& option = *(const OptionRecordBool*)record;
+      if (*option.value == option.default_value) continue;
+      value = highsBoolToString(*option.value);
+    } else if (record->type == HighsOptionType::kInt) {
+      const OptionRecordInt& option = *(const OptionRecordInt*)record;
+      if (*option.value == option.default_value) continue;
+      value = std::to_string(*option.value);
+    } else if (record->type == HighsOptionType::kDouble) {
+      const OptionRecordDouble& option = *(const OptionRecordDouble*)record;
+      if (*option.value == option.default_value) continue;
+      std::ostringstream stream;
+      stream.precision(17);
+      stream << *option.value;
+      value = stream.str();
+    } else {
+      const OptionRecordString& option = *(const OptionRecordString*)record;
+      if (*option.value == option.default_value) continue;
+      value = *option.value;
+    }
+    fprintf(file, "# option %s = %s\n", record->name.c_str(), value.c_str());
+  }
+}
+
+double mean(const std::vector<double>& values) {
+  double sum = 0;
+  for (double value : values) sum += value;
+  return sum / values.size();
+}
+
+double variance(const std::vector<double>& values) {
+  if (values.size() < 2) return 0;
+  const double values_mean = mean(values);
+  double sum_square = 0;
+  for (double value : values)
+    sum_square += (value - values_mean) * (value - values_mean);
+  return sum_square / (values.size() - 1);
+}
+
+// Critical value of the one-sided t-test at the 5% level. Rounding
+// down the degrees of freedom makes the test conservative
+double tCriticalValue(const double degrees_of_freedom) {
+  const double critical_value[] = {
+      6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+      1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+      1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697};
+  const HighsInt num_critical_value =
+      sizeof(critical_value) / sizeof(critical_value[0]);
+  const HighsInt df = std::max(HighsInt(1), HighsInt(degrees_of_freedom));
+  if (df > num_critical_value) return 1.645;
+  return critical_value[df - 1];
+}
+
+// Groups the records by model, keeping the order in which the models
+// first appear
+void groupByModel(
+    const std::vector<HighsPerfRecord>& records,
+    std::vector<std::string>& models,
+    std::map<std::string, std::vector<const HighsPerfRecord*>>& by_model) {
+  for (const HighsPerfRecord& record : records) {
+    std::vector<const HighsPerfRecord*>& model_records = by_model[record.model];
+    if (model_records.empty()) models.push_back(record.model);
+    model_records.push_back(&record);
+  }
+}
+
+// Names of the solver statistics that differ between two solves.
+// Unlike the times, they are the same for every solve unless the
+// solvers take different paths
+std::string differentStatistics(const HighsPerfRecord& baseline,
+                                const HighsPerfRecord& report) {
+  std::string different;
+  auto add = [&](const bool differ, const std::string& name) {
+    if (!differ) return;
+    if (different != "") different += ", ";
+    different += name;
+  };
+  add(baseline.model_status != report.model_status, "model_status");
+  add(std::fabs(baseline.objective_function_value -
+                report.objective_function_value) >
+          1e-6 * std::max(1.0, std::fabs(baseline.objective_function_value)),
+      "objective_function_value");
+  add(baseline.simplex_iteration_count != report.simplex_iteration_count,
+      "simplex_iteration_count");
+  add(baseline.ipm_iteration_count != report.ipm_iteration_count,
+      "ipm_iteration_count");
+  add(baseline.qp_iteration_count != report.qp_iteration_count,
+      "qp_iteration_count");
+  add(baseline.mip_node_count != report.mip_node_count, "mip_node_count");
+  add(baseline.invert_count >= 0 && report.invert_count >= 0 &&
+          baseline.invert_count != report.invert_count,
+      "invert_count");
+  return different;
+}
+
+}  // namespace
+
+HighsStatus runPerfSuite(const HighsPerfSuiteSettings& settings,
+                         const HighsOptions& options) {
+  const HighsLogOptions& log_options = options.log_options;
+  const std::string report_file = settings.report_file != ""
+                                      ? settings.report_file
+                                      : kHighsPerfReportDefaultFile;
+  std::vector<HighsPerfRecord> report;
+  if (settings.suite_file != "") {
+    std::vector<std::string> model_files;
+    if (!readPerfSuite(settings.suite_file, model_files)) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "Unable to read performance suite file \"%s\", or it has "
+                   "models with the same name\n",
+                   settings.suite_file.c_str());
+      return HighsStatus::kError;
+    }
+    const HighsInt num_repeat = std::max(HighsInt(1), settings.num_repeat);
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Solving %d models %d times each\n", (int)model_files.size(),
+                 (int)num_repeat);
+    for (const std::string& model_file : model_files) {
+      std::vector<double> run_time;
+      for (HighsInt repeat = 0; repeat < num_repeat; repeat++) {
+        bool ok;
+        HighsPerfRecord record = solvePerfModel(model_file, options, ok);
+        if (!ok) {
+          highsLogUser(log_options, HighsLogType::kError,
+                       "Unable to solve model \"%s\"\n", model_file.c_str());
+          return HighsStatus::kError;
+        }
+        record.repeat = repeat;
+        run_time.push_back(record.run_time);
+        report.push_back(record);
+      }
+      const HighsPerfRecord& record = report.back();
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%-20s %-10s mean time %9.4fs; %d simplex iterations; "
+                   "%d nodes\n",
+                   record.model.c_str(), record.model_status.c_str(),
+                   mean(run_time), (int)record.simplex_iteration_count,
+                   (int)std::max(int64_t(0), record.mip_node_count));
+    }
+    if (!writePerfReport(report_file, options, report)) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "Unable to write performance report \"%s\"\n",
+                   report_file.c_str());
+      return HighsStatus::kError;
+    }
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Performance report written to %s\n", report_file.c_str());
+  }
+  if (settings.compare_file == "") return HighsStatus::kOk;
+
+  std::vector<HighsPerfRecord> baseline;
+  if (!readPerfReport(settings.compare_file, baseline)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Unable to read performance report \"%s\"\n",
+                 settings.compare_file.c_str());
+    return HighsStatus::kError;
+  }
+  if (settings.suite_file == "" && !readPerfReport(report_file, report)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Unable to read performance report \"%s\"\n",
+                 report_file.c_str());
+    return HighsStatus::kError;
+  }
+  highsLogUser(log_options, HighsLogType::kInfo,
+               "Comparing %s with baseline %s\n", report_file.c_str(),
+               settings.compare_file.c_str());
+  return comparePerfReports(log_options, baseline, report);
+}
+
+bool readPerfSuite(const std::string& filename,
+                   std::vector<std::string>& model_files) {
+  std::ifstream file(filename);
+  if (!file) return false;
+  const std::string directory = directoryOf(filename);
+  model_files.clear();
+  // Records are identified by model name, so two models with the same
+  // name, such as x.mps and x.lp, can't both be in the suite
+  std::set<std::string> model_names;
+  std::string line;
+  while (std::getline(file, line)) {
+    line = trim(line);
+    if (line == "" || line[0] == '#') continue;
+    const bool absolute = line[0] == '/' || line[0] == '\\' ||
+                          (line.size() > 1 && line[1] == ':');
+    model_files.push_back(absolute ? line : directory + line);
+    if (!model_names.insert(modelName(line)).second) return false;
+  }
+  return true;
+}
+
+bool writePerfReport(const std::string& filename, const HighsOptions& options,
+                     const std::vector<HighsPerfRecord>& records) {
+  FILE* file = fopen(filename.c_str(), "w");
+  if (!file) return false;
+  fprintf(file, "# HiGHS performance report\n");
+  fprintf(file, "# highs_version %s\n", highsVersion());
+  fprintf(file, "# highs_githash %s\n", highsGithash());
+  writeOptionDeviations(file, options.records);
+  for (size_t iColumn = 0; iColumn < kPerfReportColumns.size(); iColumn++)
+    fprintf(file, "%s%s", iColumn ? "," : "",
+            kPerfReportColumns[iColumn].c_str());
+  fprintf(file, "\n");
+  for (const HighsPerfRecord& record : records)
+    fprintf(file,
+            "%s,%d,%s,%.17g,%.6f,%.6f,%.6f,%.6f,%d,%d,%d,%d,%lld,%lld,%.6f,"
+            "%.3f\n",
+            record.model.c_str(), (int)record.repeat,
+            record.model_status.c_str(), record.objective_function_value,
+            record.run_time, record.presolve_time, record.solve_time,
+            record.postsolve_time, (int)record.simplex_iteration_count,
+            (int)record.ipm_iteration_count,
+            (int)record.crossover_iteration_count,
+            (int)record.qp_iteration_count, (long long)record.mip_node_count,
+            (long long)record.invert_count, record.invert_time,
+            record.peak_memory_mb);
+  const bool ok = !ferror(file);
+  fclose(file);
+  return ok;
+}
+
+bool readPerfReport(const std::string& filename,
+                    std::vector<HighsPerfRecord>& records) {
+  std::ifstream file(filename);
+  if (!file) return false;
+  records.clear();
+  // Columns are identified by the header, so that reports with
+  // columns added or missing can be read
+  std::vector<std::string> header;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line == "" || line[0] == '#') continue;
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, ',')) fields.push_back(field);
+    if (header.empty()) {
+      header = fields;
+      continue;
+    }
+    if (fields.size() != header.size()) return false;
+    HighsPerfRecord record;
+    for (size_t iField = 0; iField < fields.size(); iField++) {
+      const std::string& name = header[iField];
+      const char* value = fields[iField].c_str();
+      if (name == "model") {
+        record.model = fields[iField];
+      } else if (name == "repeat") {
+        record.repeat = atoi(value);
+      } else if (name == "model_status") {
+        record.model_status = fields[iField];
+      } else if (name == "objective_function_value") {
+        record.objective_function_value = atof(value);
+      } else if (name == "run_time") {
+        record.run_time = atof(value);
+      } else if (name == "presolve_time") {
+        record.presolve_time = atof(value);
+      } else if (name == "solve_time") {
+        record.solve_time = atof(value);
+      } else if (name == "postsolve_time") {
+        record.postsolve_time = atof(value);
+      } else if (name == "simplex_iteration_count") {
+        record.simplex_iteration_count = atoi(value);
+      } else if (name == "ipm_iteration_count") {
+        record.ipm_iteration_count = atoi(value);
+      } else if (name == "crossover_iteration_count") {
+        record.crossover_iteration_count = atoi(value);
+      } else if (name == "qp_iteration_count") {
+        record.qp_iteration_count = atoi(value);
+      } else if (name == "mip_node_count") {
+        record.mip_node_count = atoll(value);
+      } else if (name == "invert_count") {
+        record.invert_count = atoll(value);
+      } else if (name == "invert_time") {
+        record.invert_time = atof(value);
+      } else if (name == "peak_memory_mb") {
+        record.peak_memory_mb = atof(value);
+      }
+    }
+    records.push_back(record);
+  }
+  return !header.empty();
+}
+
+HighsStatus comparePerfReports(const HighsLogOptions& log_options,
+                               const std::vector<HighsPerfRecord>& baseline,
+                               const std::vector<HighsPerfRecord>& report) {
+  std::vector<std::string> models;
+  std::map<std::string, std::vector<const HighsPerfRecord*>> baseline_by_model;
+  groupByModel(baseline, models, baseline_by_model);
+  std::vector<std::string> report_models;
+  std::map<std::string, std::vector<const HighsPerfRecord*>> report_by_model;
+  groupByModel(report, report_models, report_by_model);
+
+  HighsInt num_slower = 0;
+  HighsInt num_faster = 0;
+  HighsInt num_different = 0;
+  highsLogUser(log_options, HighsLogType::kInfo,
+               "%-20s %10s %10s %7s %8s  %s\n", "Model", "Baseline", "Report",
+               "Ratio", "t-value", "Result");
+  for (const std::string& model : models) {
+    auto report_it = report_by_model.find(model);
+    if (report_it == report_by_model.end()) {
+      highsLogUser(log_options, HighsLogType::kInfo, "%-20s not in report\n",
+                   model.c_str());
+      continue;
+    }
+    const std::vector<const HighsPerfRecord*>& baseline_records =
+        baseline_by_model[model];
+    const std::vector<const HighsPerfRecord*>& report_records =
+        report_it->second;
+    std::vector<double> baseline_time;
+    std::vector<double> report_time;
+    for (const HighsPerfRecord* record : baseline_records)
+      baseline_time.push_back(record->run_time);
+    for (const HighsPerfRecord* record : report_records)
+      report_time.push_back(record->run_time);
+    const double baseline_mean = mean(baseline_time);
+    const double report_mean = mean(report_time);
+    const double ratio =
+        baseline_mean > 0 ? report_mean / baseline_mean : kHighsInf;
+    // Welch's t-test for a difference in the mean run times, which
+    // does not assume that the variances are equal
+    const double baseline_var_mean =
+        variance(baseline_time) / baseline_time.size();
+    const double report_var_mean = variance(report_time) / report_time.size();
+    const double std_error = std::sqrt(baseline_var_mean + report_var_mean);
+    double t_value = 0;
+    if (std_error > 0) {
+      t_value = (report_mean - baseline_mean) / std_error;
+    } else if (report_mean != baseline_mean) {
+      t_value = report_mean > baseline_mean ? kHighsInf : -kHighsInf;
+    }
+    double degrees_of_freedom = 1;
+    if (baseline_var_mean > 0 && report_var_mean > 0) {
+      degrees_of_freedom =
+          std_error * std_error * std_error * std_error /
+          (baseline_var_mean * baseline_var_mean /
+               (baseline_time.size() - 1) +
+           report_var_mean * report_var_mean / (report_time.size() - 1));
+    } else if (baseline_var_mean > 0) {
+      degrees_of_freedom = baseline_time.size() - 1;
+    } else if (report_var_mean > 0) {
+      degrees_of_freedom = report_time.size() - 1;
+    }
+    // Significance can only be assessed with repeated solves
+    const bool repeated = baseline_time.size() > 1 && report_time.size() > 1;
+    const double t_critical = tCriticalValue(degrees_of_freedom);
+    std::string result;
+    if (!repeated) {
+      result = "not repeated";
+    } else if (ratio > 1 + kHighsPerfSlowdownTolerance &&
+               t_value > t_critical) {
+      result = "SLOWER";
+      num_slower++;
+    } else if (ratio < 1 - kHighsPerfSlowdownTolerance &&
+               t_value < -t_critical) {
+      result = "faster";
+      num_faster++;
+    }
+    const std::string different =
+        differentStatistics(*baseline_records[0], *report_records[0]);
+    if (different != "") {
+      num_different++;
+      if (result != "") result += "; ";
+      result += "different " + different;
+    }
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "%-20s %10.4f %10.4f %7.3f %8.2f  %s\n", model.c_str(),
+                 baseline_mean, report_mean, ratio, t_value, result.c_str());
+  }
+  highsLogUser(log_options, HighsLogType::kInfo,
+               "%d models significantly slower; %d models significantly "
+               "faster; %d models with different solver statistics\n",
+               (int)num_slower, (int)num_faster, (int)num_different);
+  return num_slower ? HighsStatus::kWarning : HighsStatus::kOk;
+}
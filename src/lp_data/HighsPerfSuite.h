@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsPerfSuite.h
+ * @brief Performance regression suite run from the HiGHS executable
+ *
+ * A suite file lists model files, one per line, with blank lines and
+ * lines starting with # ignored. Relative paths are relative to the
+ * directory of the suite file. Each model is solved a number of times
+ * with the same options, and the solver statistics of each solve are
+ * written to a report in CSV format. Comparing two reports flags the
+ * models whose run time has increased significantly, using Welch's
+ * t-test over the repeated solves.
+ */
+#ifndef LP_DATA_HIGHSPERFSUITE_H_
+#define LP_DATA_HIGHSPERFSUITE_H_
+
+#include <string>
+#include <vector>
+
+#include "lp_data/HighsOptions.h"
+
+const HighsInt kHighsPerfSuiteDefaultNumRepeat = 3;
+const std::string kHighsPerfReportDefaultFile = "HiGHS_perf.csv";
+// A model is slower if its mean run time has increased by more than
+// this relative tolerance, and the increase is significant
+const double kHighsPerfSlowdownTolerance = 0.05;
+
+struct HighsPerfSuiteSettings {
+  std::string suite_file = "";
+  std::string report_file = "";
+  std::string compare_file = "";
+  HighsInt num_repeat = kHighsPerfSuiteDefaultNumRepeat;
+  bool active() const { return suite_file != "" || compare_file != ""; }
+};
+
+// Statistics of one solve of a model in the suite. The presolve,
+// solve and postsolve times, and the INVERT statistics, are -1 for a
+// MIP, and aren't compared
+struct HighsPerfRecord {
+  std::string model;
+  HighsInt repeat = 0;
+  std::string model_status;
+  double objective_function_value = 0;
+  double run_time = 0;
+  double presolve_time = -1;
+  double solve_time = -1;
+  double postsolve_time = -1;
+  HighsInt simplex_iteration_count = 0;
+  HighsInt ipm_iteration_count = 0;
+  HighsInt crossover_iteration_count = 0;
+  HighsInt qp_iteration_count = 0;
+  int64_t mip_node_count = 0;
+  int64_t invert_count = -1;
+  double invert_time = -1;
+  // Peak resident memory of the process after the solve, or -1 if it
+  // is not known
+  double peak_memory_mb = -1;
+};
+
+// Solves the models in settings.suite_file, writing the report to
+// settings.report_file, then compares the report with
+// settings.compare_file if it is not empty. If there is no suite
+// file, the existing report is compared. Returns kWarning if a model
+// is significantly slower than in the report being compared with
+HighsStatus runPerfSuite(const HighsPerfSuiteSettings& settings,
+                         const HighsOptions& options);
+
+// Reads the model files in a suite, returning false if the file can't
+// be read, or two models have the same name
+bool readPerfSuite(const std::string& filename,
+                   std::vector<std::string>& model_files);
+
+bool writePerfReport(const std::string& filename, const HighsOptions& options,
+                     const std::vector<HighsPerfRecord>& records);
+
+bool readPerfReport(const std::string& filename,
+                    std::vector<HighsPerfRecord>& records);
+
+HighsStatus comparePerfReports(const HighsLogOptions& log_options,
+                               const std::vector<HighsPerfRecord>& baseline,
+                               const std::vector<HighsPerfRecord>& report);
+
+#endif /* LP_DATA_HIGHSPERFSUITE_H_ */
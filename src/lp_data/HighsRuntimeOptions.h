@@ -15,11 +15,13 @@
 #include "cxxopts.hpp"
 #include "io/HighsIO.h"
 #include "io/LoadOptions.h"
+#include "lp_data/HighsPerfSuite.h"
 #include "util/stringutil.h"
 
 bool loadOptions(const HighsLogOptions& report_log_options, int argc,
                  char** argv, HighsOptions& options, std::string& model_file,
-                 std::string& read_solution_file) {
+                 std::string& read_solution_file,
+                 HighsPerfSuiteSettings& perf_suite_settings) {
   try {
     cxxopts::Options cxx_options(argv[0], "HiGHS options");
     cxx_options.positional_help("[file]").show_positional_help();
@@ -74,6 +76,21 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
         // ranging option
         (kRangingString, "Compute cost, bound, RHS and basic solution ranging.",
          cxxopts::value<std::string>())
+        // performance suite
+        (kPerfSuiteString,
+         "File listing models to solve as a performance suite, rather than "
+         "solving a single model.",
+         cxxopts::value<std::string>())
+        (kPerfReportString,
+         "File for writing out the performance report: \"" +
+             kHighsPerfReportDefaultFile + "\" by default.",
+         cxxopts::value<std::string>())
+        (kPerfRepeatString,
+         "Number of times each model in the performance suite is solved.",
+         cxxopts::value<HighsInt>())
+        (kPerfCompareString,
+         "Performance report to compare the performance report with.",
+         cxxopts::value<std::string>())
         // version
         (kVersionString, "Print version.")("h, help", "Print help.");
 
@@ -245,6 +262,24 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
         return false;
     }
 
+    // performance suite
+    if (result.count(kPerfSuiteString))
+      perf_suite_settings.suite_file =
+          result[kPerfSuiteString].as<std::string>();
+    if (result.count(kPerfReportString))
+      perf_suite_settings.report_file =
+          result[kPerfReportString].as<std::string>();
+    if (result.count(kPerfRepeatString)) {
+      perf_suite_settings.num_repeat = result[kPerfRepeatString].as<HighsInt>();
+      if (perf_suite_settings.num_repeat < 1) {
+        std::cout << "Performance suite repeat count must be positive.\n";
+        return false;
+      }
+    }
+    if (result.count(kPerfCompareString))
+      perf_suite_settings.compare_file =
+          result[kPerfCompareString].as<std::string>();
+
   } catch (const cxxopts::OptionException& e) {
     highsLogUser(report_log_options, HighsLogType::kError,
                  "Error parsing options: %s\n", e.what());
@@ -265,8 +300,8 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
     model_file = "ml.mps";
   }
 
-  if (model_file.size() == 0) {
-    std::cout << "Please specify filename in .mps|.lp|.ems format.\n";
+  if (model_file.size() == 0 && !perf_suite_settings.active()) {
+    std::cout << "Please specify filename in .mps|.lp|.ems|.hbin format.\n";
     return false;
   }
 
@@ -423,6 +423,13 @@ class HighsDomain {
 
   void addConflictPool(HighsConflictPool& conflictPool);
 
+  /// stop propagating the cuts and conflicts of the pools, so that
+  /// propagation doesn't modify the pools
+  void removePools() {
+    cutpoolpropagation.clear();
+    conflictPoolPropagation.clear();
+  }
+
   void clearChangedCols() {
     for (HighsInt i : changedcols_) changedcolsflags_[i] = 0;
     changedcols_.clear();
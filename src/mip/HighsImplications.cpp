@@ -12,6 +12,7 @@
 
 #include "mip/HighsCliqueTable.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 
 bool HighsImplications::computeImplications(HighsInt col, bool val) {
@@ -19,42 +20,45 @@ bool HighsImplications::computeImplications(HighsInt col, bool val) {
   HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
   globaldomain.propagate();
   if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
-  const auto& domchgstack = globaldomain.getDomainChangeStack();
-  const auto& domchgreason = globaldomain.getDomainChangeReason();
-  HighsInt changedend = globaldomain.getChangedCols().size();
 
-  HighsInt stackimplicstart = domchgstack.size() + 1;
-  HighsInt numImplications = -stackimplicstart;
-  if (val)
-    globaldomain.changeBound(HighsBoundType::kLower, col, 1);
-  else
-    globaldomain.changeBound(HighsBoundType::kUpper, col, 0);
-
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
+  std::vector<HighsDomainChange> implics;
+  HighsInt numImplications;
+  if (probeFixing(globaldomain, col, val, implics, numImplications)) {
     cliquetable.vertexInfeasible(globaldomain, col, val);
 
     return true;
   }
 
-  globaldomain.propagate();
+  return storeImplications(col, val, implics, numImplications);
+}
 
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
+bool HighsImplications::probeFixing(HighsDomain& domain, HighsInt col,
+                                    bool val,
+                                    std::vector<HighsDomainChange>& implics,
+                                    HighsInt& numImplications) const {
+  const auto& domchgstack = domain.getDomainChangeStack();
+  const auto& domchgreason = domain.getDomainChangeReason();
+  HighsInt changedend = domain.getChangedCols().size();
 
-    cliquetable.vertexInfeasible(globaldomain, col, val);
+  HighsInt stackimplicstart = domchgstack.size() + 1;
+  if (val)
+    domain.changeBound(HighsBoundType::kLower, col, 1);
+  else
+    domain.changeBound(HighsBoundType::kUpper, col, 0);
+
+  if (!domain.infeasible()) domain.propagate();
+
+  if (domain.infeasible()) {
+    domain.backtrack();
+    domain.clearChangedCols(changedend);
 
     return true;
   }
 
   HighsInt stackimplicend = domchgstack.size();
-  numImplications += stackimplicend;
-  mipsolver.mipdata_->pseudocost.addInferenceObservation(col, numImplications,
-                                                         val);
+  numImplications = stackimplicend - stackimplicstart;
 
-  std::vector<HighsDomainChange> implics;
+  implics.clear();
   implics.reserve(numImplications);
 
   HighsInt numEntries = mipsolver.mipdata_->cliquetable.getNumEntries();
@@ -68,8 +72,19 @@ bool HighsImplications::computeImplications(HighsInt col, bool val) {
     implics.push_back(domchgstack[i]);
   }
 
-  globaldomain.backtrack();
-  globaldomain.clearChangedCols(changedend);
+  domain.backtrack();
+  domain.clearChangedCols(changedend);
+
+  return false;
+}
+
+bool HighsImplications::storeImplications(
+    HighsInt col, bool val, std::vector<HighsDomainChange>& implics,
+    HighsInt numImplications) {
+  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
+  mipsolver.mipdata_->pseudocost.addInferenceObservation(col, numImplications,
+                                                         val);
 
   // add the implications of binary variables to the clique table
   auto binstart = std::partition(implics.begin(), implics.end(),
@@ -132,6 +147,63 @@ bool HighsImplications::computeImplications(HighsInt col, bool val) {
   return false;
 }
 
+bool HighsImplications::applyProbingResult(HighsInt col, bool val,
+                                           ProbingResult& probingResult) {
+  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
+  globaldomain.propagate();
+  if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
+
+  // the result was computed on a copy of the global domain that is at most
+  // as tight as the global domain is now, hence the implications and the
+  // infeasibility of the fixing are still valid
+  if (probingResult.infeasible[val]) {
+    cliquetable.vertexInfeasible(globaldomain, col, val);
+
+    return true;
+  }
+
+  return storeImplications(col, val, probingResult.implics[val],
+                           probingResult.numImplications[val]);
+}
+
+void HighsImplications::probeBatch(const std::vector<HighsInt>& cols,
+                                   std::vector<ProbingResult>& probingResults,
+                                   HighsInt chunkSize) const {
+  const HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  HighsInt numCols = cols.size();
+  probingResults.resize(numCols);
+
+  // each chunk of columns is probed on its own copy of the global domain, so
+  // that the result only depends on the chunk size and not on the number of
+  // threads. Propagating cuts and conflicts resets their age in the pools,
+  // which are shared by the copies and are not thread safe, so the copies
+  // don't propagate the pools. Copies of the domain with pools register with
+  // them when constructed and unregister when destroyed, so the pools are
+  // removed from one copy outside the parallel loop, and it is copied
+  HighsInt numChunks = (numCols + chunkSize - 1) / chunkSize;
+  HighsDomain poolFreeDomain = globaldomain;
+  poolFreeDomain.removePools();
+  std::vector<HighsDomain> probingDomains(numChunks, poolFreeDomain);
+  highs::parallel::for_each(0, numChunks, [&](HighsInt start, HighsInt end) {
+    for (HighsInt chunk = start; chunk != end; ++chunk) {
+      HighsDomain& probingDomain = probingDomains[chunk];
+      HighsInt chunkEnd = std::min(numCols, (chunk + 1) * chunkSize);
+      for (HighsInt i = chunk * chunkSize; i != chunkEnd; ++i) {
+        if (cols[i] == -1) continue;
+        ProbingResult& result = probingResults[i];
+        result.infeasible[1] =
+            probeFixing(probingDomain, cols[i], 1, result.implics[1],
+                        result.numImplications[1]);
+        result.infeasible[0] =
+            !result.infeasible[1] &&
+            probeFixing(probingDomain, cols[i], 0, result.implics[0],
+                        result.numImplications[0]);
+      }
+    }
+  });
+}
+
 static constexpr bool kSkipBadVbds = true;
 static constexpr bool kUseDualsForBreakingTies = true;
 
@@ -276,20 +348,23 @@ std::pair<HighsInt, HighsImplications::VarBound> HighsImplications::getBestVlb(
   return bestVlb;
 }
 
-bool HighsImplications::runProbing(HighsInt col, HighsInt& numReductions) {
+bool HighsImplications::runProbing(HighsInt col, HighsInt& numReductions,
+                                   ProbingResult* probingResult) {
   HighsDomain& globaldomain = mipsolver.mipdata_->domain;
   if (globaldomain.isBinary(col) && !implicationsCached(col, 1) &&
       !implicationsCached(col, 0) &&
       mipsolver.mipdata_->cliquetable.getSubstitution(col) == nullptr) {
     bool infeasible;
 
-    infeasible = computeImplications(col, 1);
+    infeasible = probingResult ? applyProbingResult(col, 1, *probingResult)
+                               : computeImplications(col, 1);
     if (globaldomain.infeasible()) return true;
     if (infeasible) return true;
     if (mipsolver.mipdata_->cliquetable.getSubstitution(col) != nullptr)
       return true;
 
-    infeasible = computeImplications(col, 0);
+    infeasible = probingResult ? applyProbingResult(col, 0, *probingResult)
+                               : computeImplications(col, 0);
     if (globaldomain.infeasible()) return true;
     if (infeasible) return true;
     if (mipsolver.mipdata_->cliquetable.getSubstitution(col) != nullptr)
@@ -35,6 +35,27 @@ class HighsImplications {
 
   bool computeImplications(HighsInt col, bool val);
 
+ public:
+  /// implications of fixing a binary column to 0 and 1 that are computed on
+  /// a copy of the global domain
+  struct ProbingResult {
+    std::vector<HighsDomainChange> implics[2];
+    HighsInt numImplications[2] = {0, 0};
+    bool infeasible[2] = {false, false};
+  };
+
+ private:
+  bool probeFixing(HighsDomain& domain, HighsInt col, bool val,
+                   std::vector<HighsDomainChange>& implics,
+                   HighsInt& numImplications) const;
+
+  bool storeImplications(HighsInt col, bool val,
+                         std::vector<HighsDomainChange>& implics,
+                         HighsInt numImplications);
+
+  bool applyProbingResult(HighsInt col, bool val,
+                          ProbingResult& probingResult);
+
  public:
   struct VarBound {
     double coef;
@@ -129,7 +150,14 @@ class HighsImplications {
                                            const HighsSolution& lpSolution,
                                            double& bestLb) const;
 
-  bool runProbing(HighsInt col, HighsInt& numReductions);
+  bool runProbing(HighsInt col, HighsInt& numReductions,
+                  ProbingResult* probingResult = nullptr);
+
+  /// probe the given binary columns in parallel on copies of the propagated
+  /// global domain, columns given as -1 are skipped
+  void probeBatch(const std::vector<HighsInt>& cols,
+                  std::vector<ProbingResult>& probingResults,
+                  HighsInt chunkSize) const;
 
   void rebuild(HighsInt ncols, const std::vector<HighsInt>& cIndex,
                const std::vector<HighsInt>& rIndex);
@@ -11,6 +11,7 @@
 #include "mip/HighsMipSolver.h"
 
 #include "lp_data/HighsLpUtils.h"
+#include "lp_data/HighsMetrics.h"
 #include "lp_data/HighsModelUtils.h"
 #include "mip/HighsCliqueTable.h"
 #include "mip/HighsCutPool.h"
@@ -33,12 +34,14 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
                                const HighsOptions& options, const HighsLp& lp,
                                const HighsSolution& solution, bool submip)
     : callback_(&callback),
+      metrics_(nullptr),
       options_mip_(&options),
       model_(&lp),
       orig_model_(&lp),
       solution_objective_(kHighsInf),
       submip(submip),
       rootbasis(nullptr),
+      rootrowdual(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
       implicinit(nullptr) {
@@ -544,6 +547,11 @@ void HighsMipSolver::cleanupSolve() {
   else
     gap_ = kHighsInf;
 
+  if (metrics_)
+    metrics_->recordMip(node_count_, 0, total_lp_iterations_,
+                        mipdata_->cutpool.getNumCuts(), primal_bound_,
+                        dual_bound_, gap_ == kHighsInf ? kHighsInf : 100 * gap_);
+
   std::array<char, 128> gapString;
 
   if (gap_ == kHighsInf)
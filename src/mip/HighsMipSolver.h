@@ -20,10 +20,13 @@ class HighsCutPool;
 struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
+class HighsMetrics;
 
 class HighsMipSolver {
  public:
   HighsCallback* callback_;
+  // Live metrics to be updated, or nullptr, as for a sub-MIP
+  HighsMetrics* metrics_;
   const HighsOptions* options_mip_;
   const HighsLp* model_;
   const HighsLp* orig_model_;
@@ -40,12 +43,17 @@ class HighsMipSolver {
   double gap_;
   int64_t node_count_;
   int64_t total_lp_iterations_;
+  // Root LP basis and row duals in the space of the original model,
+  // for warm starting the next solve of a modified model
+  HighsBasis root_basis_;
+  std::vector<double> root_row_dual_;
 
   FILE* improving_solution_file_;
   std::vector<HighsObjectiveSolution> saved_objective_and_solution_;
 
   bool submip;
   const HighsBasis* rootbasis;
+  const std::vector<double>* rootrowdual;
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
@@ -13,6 +13,7 @@
 #include <random>
 
 // #include "lp_data/HighsLpUtils.h"
+#include "lp_data/HighsMetrics.h"
 #include "lp_data/HighsModelUtils.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsRedcostFixing.h"
@@ -149,6 +150,7 @@ void HighsMipSolverData::startSymmetryDetection(
     const highs::parallel::TaskGroup& taskGroup,
     std::unique_ptr<SymmetryDetectionData>& symData) {
   symData = std::unique_ptr<SymmetryDetectionData>(new SymmetryDetectionData());
+  symData->startTime = mipsolver.timer_.getWallTime();
   symData->symDetection.loadModelAsGraph(
       mipsolver.mipdata_->presolvedModel,
       mipsolver.options_mip_->small_matrix_value);
@@ -170,12 +172,26 @@ void HighsMipSolverData::startSymmetryDetection(
 void HighsMipSolverData::finishSymmetryDetection(
     const highs::parallel::TaskGroup& taskGroup,
     std::unique_ptr<SymmetryDetectionData>& symData) {
+  // bound the time by which a still running detection can delay the root node
+  double maxDelayFraction =
+      mipsolver.options_mip_->mip_symmetry_max_delay_fraction;
+  if (maxDelayFraction != kHighsInf) {
+    double currentTime = mipsolver.timer_.getWallTime();
+    symData->symDetection.setStopTime(
+        currentTime + maxDelayFraction * (currentTime - symData->startTime));
+  }
+
   taskGroup.sync();
 
   symmetries = std::move(symData->symmetries);
-  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
-               "\nSymmetry detection completed in %.1fs\n",
-               symData->detectionTime);
+  if (symData->symDetection.wasStopped())
+    highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                 "\nSymmetry detection stopped after %.1fs\n",
+                 symData->detectionTime);
+  else
+    highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                 "\nSymmetry detection completed in %.1fs\n",
+                 symData->detectionTime);
 
   if (symmetries.numGenerators == 0) {
     detectSymmetries = false;
@@ -1001,6 +1017,87 @@ void HighsMipSolverData::basisTransfer() {
   }
 }
 
+void HighsMipSolverData::warmStartRootRedcost() {
+  // any row duals yield a valid lower bound by relaxing the rows into the
+  // objective, so the row duals of the root LP of a previous solve are
+  // validated for the current model by computing this bound together with
+  // the corresponding reduced costs, which give lurking bounds before the
+  // root LP is solved
+  const std::vector<double>& origrowdual = *mipsolver.rootrowdual;
+  const HighsLp& model = *mipsolver.model_;
+  std::vector<double> rowdual(model.num_row_, 0.0);
+  HighsCDouble lagrangebound = 0.0;
+
+  for (HighsInt i = 0; i < model.num_row_; ++i) {
+    HighsInt origrow = postSolveStack.getOrigRowIndex(i);
+    if (origrow >= (HighsInt)origrowdual.size()) continue;
+    const double dual = origrowdual[origrow];
+    if (dual > 0) {
+      if (model.row_lower_[i] == -kHighsInf) continue;
+      lagrangebound += dual * model.row_lower_[i];
+    } else if (dual < 0) {
+      if (model.row_upper_[i] == kHighsInf) continue;
+      lagrangebound += dual * model.row_upper_[i];
+    } else
+      continue;
+
+    rowdual[i] = dual;
+  }
+
+  std::vector<double> redcost(model.num_col_);
+  for (HighsInt i = 0; i < model.num_col_; ++i) {
+    HighsCDouble sum = model.col_cost_[i];
+    for (HighsInt j = model.a_matrix_.start_[i];
+         j != model.a_matrix_.start_[i + 1]; ++j)
+      sum -= model.a_matrix_.value_[j] * rowdual[model.a_matrix_.index_[j]];
+
+    redcost[i] = double(sum);
+    if (std::fabs(redcost[i]) <= mipsolver.options_mip_->small_matrix_value)
+      redcost[i] = 0.0;
+    else if (redcost[i] > 0) {
+      if (domain.col_lower_[i] == -kHighsInf) return;
+      lagrangebound += redcost[i] * domain.col_lower_[i];
+    } else if (redcost[i] < 0) {
+      if (domain.col_upper_[i] == kHighsInf) return;
+      lagrangebound += redcost[i] * domain.col_upper_[i];
+    }
+  }
+
+  const double bound = double(lagrangebound);
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "Root row duals of previous solve give dual bound %g\n",
+              bound + mipsolver.model_->offset_);
+
+  lower_bound = std::max(lower_bound, bound);
+  redcostfixing.addRootRedcost(mipsolver, redcost, bound);
+  if (upper_limit != kHighsInf) redcostfixing.propagateRootRedcost(mipsolver);
+}
+
+void HighsMipSolverData::saveRootWarmStart() {
+  // expand the root basis and row duals to the original space so that they
+  // can be used to warm start the next solve of a modified model
+  const HighsSolution& solution = lp.getLpSolver().getSolution();
+  if (!firstrootbasis.valid || !solution.dual_valid) return;
+
+  HighsBasis& root_basis = mipsolver.root_basis_;
+  root_basis.col_status.assign(postSolveStack.getOrigNumCol(),
+                               HighsBasisStatus::kNonbasic);
+  root_basis.row_status.assign(postSolveStack.getOrigNumRow(),
+                               HighsBasisStatus::kBasic);
+  root_basis.valid = true;
+  mipsolver.root_row_dual_.assign(postSolveStack.getOrigNumRow(), 0.0);
+
+  for (HighsInt i = 0; i < mipsolver.numCol(); ++i)
+    root_basis.col_status[postSolveStack.getOrigColIndex(i)] =
+        firstrootbasis.col_status[i];
+
+  for (HighsInt i = 0; i < mipsolver.numRow(); ++i) {
+    HighsInt origrow = postSolveStack.getOrigRowIndex(i);
+    root_basis.row_status[origrow] = firstrootbasis.row_status[i];
+    mipsolver.root_row_dual_[origrow] = solution.row_dual[i];
+  }
+}
+
 const std::vector<double>& HighsMipSolverData::getSolution() const {
   return incumbent;
 }
@@ -1362,6 +1459,7 @@ restart:
   domain.clearChangedCols();
   lp.setObjectiveLimit(upper_limit);
   lower_bound = std::max(lower_bound, domain.getObjectiveLowerBound());
+  if (numRestarts == 0 && mipsolver.rootrowdual) warmStartRootRedcost();
 
   printDisplayLine();
 
@@ -1404,6 +1502,9 @@ restart:
     firstrootbasis.valid = true;
   }
 
+  if (!mipsolver.submip && mipsolver.options_mip_->mip_root_warm_start)
+    saveRootWarmStart();
+
   if (cutpool.getNumCuts() != 0) {
     assert(numRestarts != 0);
     HighsCutSet cutset;
@@ -1694,6 +1795,8 @@ restart:
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
+  if (mipsolver.metrics_) updateMetrics();
+
   // Possible user interrupt
   if (!mipsolver.submip && mipsolver.callback_->user_callback) {
     mipsolver.callback_->clearHighsCallbackDataOut();
@@ -1857,6 +1960,16 @@ void HighsMipSolverData::saveReportMipSolution(const double new_upper_limit) {
   }
 }
 
+void HighsMipSolverData::updateMetrics() const {
+  double dual_bound;
+  double primal_bound;
+  double mip_rel_gap;
+  limitsToBounds(dual_bound, primal_bound, mip_rel_gap);
+  mipsolver.metrics_->recordMip(num_nodes, nodequeue.numActiveNodes(),
+                                total_lp_iterations, cutpool.getNumCuts(),
+                                primal_bound, dual_bound, mip_rel_gap);
+}
+
 void HighsMipSolverData::limitsToBounds(double& dual_bound,
                                         double& primal_bound,
                                         double& mip_rel_gap) const {
@@ -141,6 +141,7 @@ struct HighsMipSolverData {
   struct SymmetryDetectionData {
     HighsSymmetryDetection symDetection;
     HighsSymmetries symmetries;
+    double startTime = 0.0;
     double detectionTime = 0.0;
   };
 
@@ -155,6 +156,8 @@ struct HighsMipSolverData {
   void removeFixedIndices();
   void init();
   void basisTransfer();
+  void warmStartRootRedcost();
+  void saveRootWarmStart();
   void checkObjIntegrality();
   void runPresolve();
   void setupDomainPropagation();
@@ -184,6 +187,7 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits(int64_t nodeOffset = 0) const;
+  void updateMetrics() const;
   void limitsToBounds(double& dual_bound, double& primal_bound,
                       double& mip_rel_gap) const;
   bool interruptFromCallbackWithData(const int callback_type,
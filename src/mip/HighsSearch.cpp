@@ -16,6 +16,7 @@
 #include "mip/HighsCutGeneration.h"
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolverData.h"
+#include "util/HighsTrace.h"
 
 HighsSearch::HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost)
     : mipsolver(mipsolver),
@@ -959,6 +960,7 @@ void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node) {
 
 HighsSearch::NodeResult HighsSearch::evaluateNode() {
   assert(!nodestack.empty());
+  HighsTraceScope trace("mip", "node");
   NodeData& currnode = nodestack.back();
   const NodeData* parent = getParentNodeData();
 
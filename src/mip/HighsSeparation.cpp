@@ -24,6 +24,7 @@
 #include "mip/HighsPathSeparator.h"
 #include "mip/HighsTableauSeparator.h"
 #include "mip/HighsTransformedLp.h"
+#include "util/HighsTrace.h"
 
 HighsSeparation::HighsSeparation(const HighsMipSolver& mipsolver) {
   implBoundClock = mipsolver.timer_.clock_def("Implbound sepa", "Ibd");
@@ -35,6 +36,7 @@ HighsSeparation::HighsSeparation(const HighsMipSolver& mipsolver) {
 
 HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
                                           HighsLpRelaxation::Status& status) {
+  HighsTraceScope trace("mip", "separation round");
   const HighsSolution& sol = lp->getLpSolver().getSolution();
 
   HighsMipSolverData& mipdata = *lp->getMipSolver().mipdata_;
@@ -34,7 +34,9 @@ void HighsHessian::exactResize() {
     this->index_.resize(num_nz);
     this->value_.resize(num_nz);
   } else {
-    this->start_.clear();
+    // An empty Hessian still has a start for the (nonexistent) first
+    // column, as after clear()
+    this->start_.assign(1, 0);
     this->index_.clear();
     this->value_.clear();
   }
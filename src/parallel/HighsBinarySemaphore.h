@@ -53,12 +53,15 @@ class HighsBinarySemaphore {
         expected, 0, std::memory_order_acquire, std::memory_order_relaxed);
   }
 
-  void acquire() {
+  // Spin for up to maxSpinMicroSecs before waiting on the condition
+  // variable
+  void acquire(
+      int maxSpinMicroSecs = HighsSchedulerConstants::kMicroSecsBeforeSleep) {
     if (try_acquire()) return;
 
     auto tStart = std::chrono::high_resolution_clock::now();
     int spinIters = 10;
-    while (true) {
+    while (maxSpinMicroSecs > 0) {
       for (int i = 0; i < spinIters; ++i) {
         if (data_->count.load(std::memory_order_relaxed) == 1) {
           if (try_acquire()) return;
@@ -71,7 +74,7 @@ class HighsBinarySemaphore {
               std::chrono::high_resolution_clock::now() - tStart)
               .count();
 
-      if (numMicroSecs < HighsSchedulerConstants::kMicroSecsBeforeSleep)
+      if (numMicroSecs < maxSpinMicroSecs)
         spinIters *= 2;
       else
         break;
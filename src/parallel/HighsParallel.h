@@ -22,10 +22,12 @@ namespace parallel {
 
 using mutex = HighsMutex;
 
-inline void initialize_scheduler(int numThreads = 0) {
+inline void initialize_scheduler(
+    int numThreads = 0,
+    const HighsSchedulerConfig& config = HighsSchedulerConfig()) {
   if (numThreads == 0)
     numThreads = (std::thread::hardware_concurrency() + 1) / 2;
-  HighsTaskExecutor::initialize(numThreads);
+  HighsTaskExecutor::initialize(numThreads, config);
 }
 
 inline int num_threads() {
@@ -18,7 +18,25 @@ struct HighsSchedulerConstants {
     kNumTryFac = 16,
     kMicroSecsBeforeSleep = 5000,
     kMicroSecsBeforeGlobalSync = 1000,
+    kMinAdaptiveSpinMicroSecs = 20,
+    kMaxWakeupMicroSecs = 200,
   };
 };
 
+// How a worker that runs out of tasks waits for more: by spinning for
+// up to a fixed time before parking, by parking almost at once, or by
+// spinning for about as long as it has recently had to wait
+enum class HighsIdlePolicy { kSpin = 0, kPark, kAdaptive };
+
+// Settings of a task executor, fixed when it is created
+struct HighsSchedulerConfig {
+  // Pin worker threads to CPUs, filling one NUMA node before the next
+  bool pinThreads = false;
+  // With pinned threads, steal from workers on the same node first
+  bool localityAwareStealing = false;
+  HighsIdlePolicy idlePolicy = HighsIdlePolicy::kSpin;
+  // Longest time an idle worker spins before parking
+  int maxSpinMicroSecs = HighsSchedulerConstants::kMicroSecsBeforeSleep;
+};
+
 #endif
\ No newline at end of file
@@ -13,6 +13,7 @@
 #ifndef HIGHS_SPLIT_DEQUE_H_
 #define HIGHS_SPLIT_DEQUE_H_
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
@@ -38,6 +39,32 @@ class HighsSplitDeque {
   };
   struct WorkerBunk;
 
+  // Counts and times recorded by a worker since its deque was created
+  // or its statistics were last reset
+  struct WorkerStats {
+    // tasks spawned and then run by the worker itself
+    uint64_t numTasksRun = 0;
+    // tasks run by the worker after stealing them, or having them
+    // injected when it was idle
+    uint64_t numTasksStolen = 0;
+    // attempts to steal from a random worker that found nothing
+    uint64_t numFailedSteals = 0;
+    // tasks run as soon as they were spawned, as the task array was
+    // full
+    uint64_t numOverflowTasks = 0;
+    // seconds spent looking for tasks to steal, and waiting for tasks
+    // to be injected
+    double stealLoopTime = 0;
+    double parkedTime = 0;
+    // times the worker was woken with a task while idle, and the
+    // total seconds from the task being injected to the worker
+    // running it
+    uint64_t numWakeups = 0;
+    double wakeupLatency = 0;
+    // current time for which the worker spins before parking
+    int spinMicroSecs = 0;
+  };
+
  private:
   struct OwnerData {
     cache_aligned::shared_ptr<WorkerBunk> workerBunk = nullptr;
@@ -54,6 +81,8 @@ class HighsSplitDeque {
   struct StealerData {
     HighsBinarySemaphore semaphore{0};
     HighsTask* injectedTask{nullptr};
+    // when the injected task was injected, for the wake-up latency
+    std::atomic<int64_t> injectMicroSecs{0};
     std::atomic<uint64_t> ts{0};
     std::atomic<bool> allStolen{true};
   };
@@ -76,6 +105,45 @@ class HighsSplitDeque {
     int ownerId;
   };
 
+  // Workers with ids in [groupBegin, groupEnd) share this worker's
+  // NUMA node
+  struct LocalityData {
+    int groupBegin = 0;
+    int groupEnd = 0;
+  };
+
+  // Only the owner updates the counters, so they are atomic just to be
+  // readable by other threads
+  struct StatsData {
+    std::atomic<uint64_t> numTasksRun{0};
+    std::atomic<uint64_t> numTasksStolen{0};
+    std::atomic<uint64_t> numFailedSteals{0};
+    std::atomic<uint64_t> numOverflowTasks{0};
+    std::atomic<uint64_t> stealLoopMicroSecs{0};
+    std::atomic<uint64_t> parkedMicroSecs{0};
+    std::atomic<uint64_t> numWakeups{0};
+    std::atomic<uint64_t> wakeupMicroSecs{0};
+  };
+
+  // Settings and state of the idle policy, updated only by the owner
+  struct IdleData {
+    HighsIdlePolicy policy = HighsIdlePolicy::kSpin;
+    int maxSpinMicroSecs = HighsSchedulerConstants::kMicroSecsBeforeSleep;
+    std::atomic<int> spinMicroSecs{
+        HighsSchedulerConstants::kMicroSecsBeforeSleep};
+  };
+
+  static int64_t microSecsNow() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::high_resolution_clock::now().time_since_epoch())
+        .count();
+  }
+
+  static void addToCounter(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+  }
+
  public:
   struct WorkerBunk {
     static constexpr uint64_t kAbaTagShift = 20;
@@ -164,8 +232,12 @@ class HighsSplitDeque {
     }
 
     HighsTask* waitForNewTask(HighsSplitDeque* localDeque) {
+      auto tStart = std::chrono::high_resolution_clock::now();
       pushSleeper(localDeque);
-      localDeque->stealerData.semaphore.acquire();
+      localDeque->stealerData.semaphore.acquire(
+          localDeque->getSpinMicroSecs());
+      localDeque->addStealLoopOrParkedTime(tStart, false);
+      localDeque->recordWakeup(tStart);
       return localDeque->stealerData.injectedTask;
     }
   };
@@ -177,11 +249,20 @@ class HighsSplitDeque {
                 "sizeof(StealerData) exceeds cache line size");
   static_assert(sizeof(WorkerBunkData) <= 64,
                 "sizeof(GlobalQueueData) exceeds cache line size");
+  static_assert(sizeof(LocalityData) <= 64,
+                "sizeof(LocalityData) exceeds cache line size");
+  static_assert(sizeof(StatsData) <= 64,
+                "sizeof(StatsData) exceeds cache line size");
+  static_assert(sizeof(IdleData) <= 64,
+                "sizeof(IdleData) exceeds cache line size");
 
   alignas(64) OwnerData ownerData;
   alignas(64) std::atomic<bool> splitRequest;
   alignas(64) StealerData stealerData;
   alignas(64) WorkerBunkData workerBunkData;
+  alignas(64) LocalityData localityData;
+  alignas(64) StatsData statsData;
+  alignas(64) IdleData idleData;
   alignas(64) std::array<HighsTask, kTaskArraySize> taskArray;
 
   void growShared() {
@@ -253,6 +334,8 @@ class HighsSplitDeque {
     ownerData.workers = workers;
     ownerData.numWorkers = numWorkers;
     workerBunkData.ownerId = ownerId;
+    localityData.groupBegin = 0;
+    localityData.groupEnd = numWorkers;
     ownerData.randgen.initialise(ownerId);
     ownerData.workerBunk = workerBunk;
     splitRequest.store(false, std::memory_order_relaxed);
@@ -264,7 +347,13 @@ class HighsSplitDeque {
                   "alignas failed to guarantee 64 byte alignment");
     static_assert(offsetof(HighsSplitDeque, workerBunkData) == 192,
                   "alignas failed to guarantee 64 byte alignment");
-    static_assert(offsetof(HighsSplitDeque, taskArray) == 256,
+    static_assert(offsetof(HighsSplitDeque, localityData) == 256,
+                  "alignas failed to guarantee 64 byte alignment");
+    static_assert(offsetof(HighsSplitDeque, statsData) == 320,
+                  "alignas failed to guarantee 64 byte alignment");
+    static_assert(offsetof(HighsSplitDeque, idleData) == 384,
+                  "alignas failed to guarantee 64 byte alignment");
+    static_assert(offsetof(HighsSplitDeque, taskArray) == 448,
                   "alignas failed to guarantee 64 byte alignment");
   }
 
@@ -287,6 +376,7 @@ class HighsSplitDeque {
         growShared();
 
       ownerData.head += 1;
+      addToCounter(statsData.numOverflowTasks, 1);
       f();
       return;
     }
@@ -346,6 +436,7 @@ class HighsSplitDeque {
     } else if (ownerData.head != ownerData.splitCopy)
       growShared();
 
+    addToCounter(statsData.numTasksRun, 1);
     return std::make_pair(Status::kWork, &taskArray[ownerData.head]);
   }
 
@@ -434,11 +525,41 @@ class HighsSplitDeque {
     assert(next >= 0);
     assert(next < ownerData.numWorkers);
 
-    return ownerData.workers[next]->steal();
+    HighsTask* task = ownerData.workers[next]->steal();
+    if (!task) addToCounter(statsData.numFailedSteals, 1);
+    return task;
+  }
+
+  void setLocalGroup(int groupBegin, int groupEnd) {
+    assert(groupBegin <= ownerData.ownerId && ownerData.ownerId < groupEnd);
+    localityData.groupBegin = groupBegin;
+    localityData.groupEnd = groupEnd;
+  }
+
+  int getNumLocalWorkers() const {
+    return localityData.groupEnd - localityData.groupBegin;
+  }
+
+  // As randomSteal, but from a worker on the same NUMA node
+  HighsTask* randomLocalSteal() {
+    const int numOthers = getNumLocalWorkers() - 1;
+    if (numOthers <= 0) return nullptr;
+    HighsInt next =
+        localityData.groupBegin + ownerData.randgen.integer(numOthers);
+    next += next >= ownerData.ownerId;
+    assert(next != ownerData.ownerId);
+    assert(next >= localityData.groupBegin);
+    assert(next < localityData.groupEnd);
+
+    HighsTask* task = ownerData.workers[next]->steal();
+    if (!task) addToCounter(statsData.numFailedSteals, 1);
+    return task;
   }
 
   void injectTaskAndNotify(HighsTask* t) {
     stealerData.injectedTask = t;
+    stealerData.injectMicroSecs.store(microSecsNow(),
+                                      std::memory_order_relaxed);
     stealerData.semaphore.release();
   }
 
@@ -448,6 +569,7 @@ class HighsSplitDeque {
   void wait() { stealerData.semaphore.acquire(); }
 
   void runStolenTask(HighsTask* task) {
+    addToCounter(statsData.numTasksStolen, 1);
     HighsTask* prevRootTask = ownerData.rootTask;
     ownerData.rootTask = task;
     uint32_t currentHead = ownerData.head;
@@ -506,7 +628,7 @@ class HighsSplitDeque {
                     std::chrono::high_resolution_clock::now() - tStart)
                     .count();
 
-            if (numMicroSecs < HighsSchedulerConstants::kMicroSecsBeforeSleep)
+            if (numMicroSecs < getSpinMicroSecs())
               numTries *= 2;
             else {
               waitForTaskToFinish(popResult.second, stealer);
@@ -569,6 +691,101 @@ class HighsSplitDeque {
     if (t) runStolenTask(t);
   }
 
+  // Record the time since tStart as spent in the steal loop, or
+  // parked waiting for a task
+  void addStealLoopOrParkedTime(
+      std::chrono::high_resolution_clock::time_point tStart, bool stealLoop) {
+    uint64_t numMicroSecs =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now() - tStart)
+            .count();
+    addToCounter(
+        stealLoop ? statsData.stealLoopMicroSecs : statsData.parkedMicroSecs,
+        numMicroSecs);
+  }
+
+  void setIdlePolicy(HighsIdlePolicy policy, int maxSpinMicroSecs) {
+    idleData.policy = policy;
+    idleData.maxSpinMicroSecs = std::max(maxSpinMicroSecs, 0);
+    idleData.spinMicroSecs.store(
+        policy == HighsIdlePolicy::kPark ? 0 : idleData.maxSpinMicroSecs,
+        std::memory_order_relaxed);
+  }
+
+  // Time for which the worker spins when idle before parking
+  int getSpinMicroSecs() const {
+    return idleData.spinMicroSecs.load(std::memory_order_relaxed);
+  }
+
+  // Record the latency of a wake-up with a task after idling since
+  // tStart and, with the adaptive policy, move the spin time towards
+  // twice the time the worker waited for the task to arrive: work that
+  // arrives soon after a worker becomes idle is then met by a spinning
+  // worker, and work that arrives rarely does not keep a worker
+  // spinning. If the worker was slow to run its task, the CPUs are
+  // oversubscribed and spinning only delays the threads with work, so
+  // the spin time drops to its minimum
+  void recordWakeup(std::chrono::high_resolution_clock::time_point tStart) {
+    if (!stealerData.injectedTask) return;
+    const int64_t latency = std::max(
+        microSecsNow() -
+            stealerData.injectMicroSecs.load(std::memory_order_relaxed),
+        int64_t{0});
+    addToCounter(statsData.numWakeups, 1);
+    addToCounter(statsData.wakeupMicroSecs, latency);
+    if (idleData.policy != HighsIdlePolicy::kAdaptive) return;
+    const int64_t arrivalMicroSecs =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now() - tStart)
+            .count() -
+        latency;
+    int64_t spinMicroSecs = 0;
+    if (latency <= HighsSchedulerConstants::kMaxWakeupMicroSecs) {
+      const int64_t target =
+          std::min(2 * std::max(arrivalMicroSecs, int64_t{0}),
+                   int64_t{idleData.maxSpinMicroSecs});
+      spinMicroSecs = (getSpinMicroSecs() + target) / 2;
+    }
+    spinMicroSecs = std::max(
+        spinMicroSecs,
+        std::min(int64_t{HighsSchedulerConstants::kMinAdaptiveSpinMicroSecs},
+                 int64_t{idleData.maxSpinMicroSecs}));
+    idleData.spinMicroSecs.store(int(spinMicroSecs), std::memory_order_relaxed);
+  }
+
+  WorkerStats getStats() const {
+    WorkerStats stats;
+    stats.numTasksRun = statsData.numTasksRun.load(std::memory_order_relaxed);
+    stats.numTasksStolen =
+        statsData.numTasksStolen.load(std::memory_order_relaxed);
+    stats.numFailedSteals =
+        statsData.numFailedSteals.load(std::memory_order_relaxed);
+    stats.numOverflowTasks =
+        statsData.numOverflowTasks.load(std::memory_order_relaxed);
+    stats.stealLoopTime =
+        1e-6 * statsData.stealLoopMicroSecs.load(std::memory_order_relaxed);
+    stats.parkedTime =
+        1e-6 * statsData.parkedMicroSecs.load(std::memory_order_relaxed);
+    stats.numWakeups = statsData.numWakeups.load(std::memory_order_relaxed);
+    stats.wakeupLatency =
+        1e-6 * statsData.wakeupMicroSecs.load(std::memory_order_relaxed);
+    stats.spinMicroSecs = getSpinMicroSecs();
+    return stats;
+  }
+
+  // Counts are only updated by the owner, so any update made while
+  // they are being reset may be lost
+  void resetStats() {
+    statsData.numTasksRun.store(0, std::memory_order_relaxed);
+    statsData.numTasksStolen.store(0, std::memory_order_relaxed);
+    statsData.numFailedSteals.store(0, std::memory_order_relaxed);
+    statsData.numOverflowTasks.store(0, std::memory_order_relaxed);
+    statsData.stealLoopMicroSecs.store(0, std::memory_order_relaxed);
+    statsData.parkedMicroSecs.store(0, std::memory_order_relaxed);
+    statsData.numWakeups.store(0, std::memory_order_relaxed);
+    statsData.wakeupMicroSecs.store(0, std::memory_order_relaxed);
+  }
+
   int getOwnerId() const { return ownerData.ownerId; }
 
   int getNumWorkers() const { return ownerData.numWorkers; }
@@ -14,14 +14,21 @@ HighsTaskExecutor::ExecutorHandle&
 HighsTaskExecutor::threadLocalExecutorHandle() {
   return globalExecutorHandle;
 }
+
+static thread_local HighsTaskExecutor* boundExecutorPtr{nullptr};
+
+HighsTaskExecutor*& HighsTaskExecutor::threadLocalBoundExecutor() {
+  return boundExecutorPtr;
+}
 #else
 thread_local HighsSplitDeque* HighsTaskExecutor::threadLocalWorkerDequePtr{
     nullptr};
 thread_local HighsTaskExecutor::ExecutorHandle
     HighsTaskExecutor::globalExecutorHandle{};
+thread_local HighsTaskExecutor* HighsTaskExecutor::boundExecutorPtr{nullptr};
 #endif
 
 HighsTaskExecutor::ExecutorHandle::~ExecutorHandle() {
   if (ptr && this == ptr->mainWorkerHandle.load(std::memory_order_relaxed))
-    HighsTaskExecutor::shutdown();
+    HighsTaskExecutor::shutdown(*this);
 }
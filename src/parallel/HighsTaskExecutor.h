@@ -17,12 +17,14 @@
 #include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 #include "parallel/HighsCacheAlign.h"
 #include "parallel/HighsSchedulerConstants.h"
 #include "parallel/HighsSplitDeque.h"
+#include "parallel/HighsWorkerPlacement.h"
 #include "util/HighsInt.h"
 #include "util/HighsRandom.h"
 
@@ -39,9 +41,11 @@ class HighsTaskExecutor {
 #ifdef _WIN32
   static HighsSplitDeque*& threadLocalWorkerDeque();
   static ExecutorHandle& threadLocalExecutorHandle();
+  static HighsTaskExecutor*& threadLocalBoundExecutor();
 #else
   static thread_local HighsSplitDeque* threadLocalWorkerDequePtr;
   static thread_local ExecutorHandle globalExecutorHandle;
+  static thread_local HighsTaskExecutor* boundExecutorPtr;
 
   static HighsSplitDeque*& threadLocalWorkerDeque() {
     return threadLocalWorkerDequePtr;
@@ -50,23 +54,64 @@ class HighsTaskExecutor {
   static ExecutorHandle& threadLocalExecutorHandle() {
     return globalExecutorHandle;
   }
+
+  // Executor that the thread is bound to as worker 0 by a
+  // ScopedBinding, rather than through its thread-local handle
+  static HighsTaskExecutor*& threadLocalBoundExecutor() {
+    return boundExecutorPtr;
+  }
 #endif
 
   std::vector<cache_aligned::unique_ptr<HighsSplitDeque>> workerDeques;
   cache_aligned::shared_ptr<HighsSplitDeque::WorkerBunk> workerBunk;
   std::atomic<ExecutorHandle*> mainWorkerHandle;
+  // Held by the thread that is bound to the executor as worker 0
+  std::mutex bindMutex;
+  // Set up only when worker threads are pinned to CPUs
+  HighsWorkerPlacement placement;
+  std::atomic<int> numDequesCreated;
+  HighsSchedulerConfig config;
+
+  cache_aligned::unique_ptr<HighsSplitDeque> createWorkerDeque(int workerId) {
+    const int numWorkers = workerDeques.size();
+    auto deque = cache_aligned::make_unique<HighsSplitDeque>(
+        workerBunk, workerDeques.data(), workerId, numWorkers);
+    if (!placement.empty())
+      deque->setLocalGroup(placement.groupBegin(workerId),
+                           placement.groupEnd(workerId));
+    deque->setIdlePolicy(config.idlePolicy, config.maxSpinMicroSecs);
+    return deque;
+  }
 
   HighsTask* random_steal_loop(HighsSplitDeque* localDeque) {
     const int numWorkers = workerDeques.size();
 
     int numTries = 16 * (numWorkers - 1);
+    // Workers on the same NUMA node are tried first
+    const int numLocalWorkers = localDeque->getNumLocalWorkers();
+    const int numLocalTries = config.localityAwareStealing &&
+                                      numLocalWorkers > 1 &&
+                                      numLocalWorkers < numWorkers
+                                  ? 16 * (numLocalWorkers - 1)
+                                  : 0;
 
     auto tStart = std::chrono::high_resolution_clock::now();
 
     while (true) {
+      for (int s = 0; s < numLocalTries; ++s) {
+        HighsTask* task = localDeque->randomLocalSteal();
+        if (task) {
+          localDeque->addStealLoopOrParkedTime(tStart, true);
+          return task;
+        }
+      }
+
       for (int s = 0; s < numTries; ++s) {
         HighsTask* task = localDeque->randomSteal();
-        if (task) return task;
+        if (task) {
+          localDeque->addStealLoopOrParkedTime(tStart, true);
+          return task;
+        }
       }
 
       if (!workerBunk->haveJobs.load(std::memory_order_relaxed)) break;
@@ -76,16 +121,26 @@ class HighsTaskExecutor {
               std::chrono::high_resolution_clock::now() - tStart)
               .count();
 
-      if (numMicroSecs < HighsSchedulerConstants::kMicroSecsBeforeGlobalSync)
+      if (numMicroSecs <
+          std::min(int{HighsSchedulerConstants::kMicroSecsBeforeGlobalSync},
+                   localDeque->getSpinMicroSecs()))
         numTries *= 2;
       else
         break;
     }
 
+    localDeque->addStealLoopOrParkedTime(tStart, true);
     return nullptr;
   }
 
   void run_worker(int workerId) {
+    if (!placement.empty()) {
+      // The worker's deque is created once the thread is pinned, so
+      // that its task array is allocated on the worker's NUMA node
+      placement.pinThisThread(workerId);
+      workerDeques[workerId] = createWorkerDeque(workerId);
+      numDequesCreated.fetch_add(1, std::memory_order_release);
+    }
     // spin until the global executor pointer is set up
     ExecutorHandle* executor;
     // Following yields warning C4706: assignment within conditional
@@ -114,18 +169,32 @@ class HighsTaskExecutor {
   }
 
  public:
-  HighsTaskExecutor(int numThreads) {
+  // If config.pinThreads is true, worker threads other than worker 0
+  // (the thread that uses the executor) are pinned to CPUs
+  HighsTaskExecutor(int numThreads,
+                    const HighsSchedulerConfig& config = HighsSchedulerConfig())
+      : config(config) {
     assert(numThreads > 0);
     mainWorkerHandle.store(nullptr, std::memory_order_relaxed);
+    numDequesCreated.store(1, std::memory_order_relaxed);
     workerDeques.resize(numThreads);
     workerBunk = cache_aligned::make_shared<HighsSplitDeque::WorkerBunk>();
-    for (int i = 0; i < numThreads; ++i)
-      workerDeques[i] = cache_aligned::make_unique<HighsSplitDeque>(
-          workerBunk, workerDeques.data(), i, numThreads);
+    if (config.pinThreads && numThreads > 1) placement.setup(numThreads);
+    workerDeques[0] = createWorkerDeque(0);
+    if (placement.empty()) {
+      for (int i = 1; i < numThreads; ++i)
+        workerDeques[i] = createWorkerDeque(i);
+    }
 
-    threadLocalWorkerDeque() = workerDeques[0].get();
     for (int i = 1; i < numThreads; ++i)
       std::thread([&](int id) { run_worker(id); }, i).detach();
+
+    // pinned workers create their own deques, all of which must exist
+    // before any worker can steal
+    if (!placement.empty()) {
+      while (numDequesCreated.load(std::memory_order_acquire) != numThreads)
+        std::this_thread::yield();
+    }
   }
 
   static HighsSplitDeque* getThisWorkerDeque() {
@@ -136,18 +205,111 @@ class HighsTaskExecutor {
     return threadLocalWorkerDeque()->getNumWorkers();
   }
 
-  static void initialize(int numThreads) {
+  static bool isInitialized() {
+    return threadLocalExecutorHandle().ptr != nullptr ||
+           threadLocalBoundExecutor() != nullptr;
+  }
+
+  // Create the executor of the calling thread, which becomes its
+  // worker 0. Nothing is done if the thread already has an executor,
+  // or is bound to one
+  static void initialize(
+      int numThreads,
+      const HighsSchedulerConfig& config = HighsSchedulerConfig()) {
     auto& executorHandle = threadLocalExecutorHandle();
-    if (!executorHandle.ptr) {
-      executorHandle.ptr =
-          cache_aligned::make_shared<HighsTaskExecutor>(numThreads);
-      executorHandle.ptr->mainWorkerHandle.store(&executorHandle,
-                                                 std::memory_order_release);
+    if (!executorHandle.ptr && !threadLocalBoundExecutor()) {
+      initialize(executorHandle, numThreads, config);
+      threadLocalWorkerDeque() = executorHandle.ptr->workerDeques[0].get();
     }
   }
 
+  static void initialize(ExecutorHandle& executorHandle, int numThreads,
+                         const HighsSchedulerConfig& config) {
+    executorHandle.ptr =
+        cache_aligned::make_shared<HighsTaskExecutor>(numThreads, config);
+    executorHandle.ptr->mainWorkerHandle.store(&executorHandle,
+                                               std::memory_order_release);
+  }
+
+  // Create an executor with its own worker threads that belongs to no
+  // thread. Threads use it by way of a ScopedBinding, and it is shut
+  // down when the last copy of the returned handle is released
+  static std::shared_ptr<ExecutorHandle> createExecutor(
+      int numThreads,
+      const HighsSchedulerConfig& config = HighsSchedulerConfig()) {
+    assert(numThreads > 0);
+    std::shared_ptr<ExecutorHandle> executorHandle =
+        std::make_shared<ExecutorHandle>();
+    initialize(*executorHandle, numThreads, config);
+    return executorHandle;
+  }
+
+  static int getNumWorkerThreads(const ExecutorHandle& executorHandle) {
+    return executorHandle.ptr ? (int)executorHandle.ptr->workerDeques.size()
+                              : 0;
+  }
+
+  // While in scope, the calling thread acts as worker 0 of the given
+  // executor. An executor has only one worker 0, so a thread that
+  // binds to an executor in use by another thread waits until it is
+  // released. Binding a thread to the executor it is already bound
+  // to, or that it is a worker of, has no effect: a task running on a
+  // worker of the executor must not wait for the thread bound to it,
+  // since that thread may be waiting for the task
+  class ScopedBinding {
+    std::shared_ptr<ExecutorHandle> executorHandle;
+    std::unique_lock<std::mutex> lock;
+    HighsTaskExecutor* prevBoundExecutor;
+    HighsSplitDeque* prevWorkerDeque;
+
+   public:
+    explicit ScopedBinding(std::shared_ptr<ExecutorHandle> handle)
+        : executorHandle(std::move(handle)),
+          prevBoundExecutor(threadLocalBoundExecutor()),
+          prevWorkerDeque(threadLocalWorkerDeque()) {
+      HighsTaskExecutor* executor =
+          executorHandle ? executorHandle->ptr.get() : nullptr;
+      if (!executor || executor == prevBoundExecutor ||
+          executor == threadLocalExecutorHandle().ptr.get())
+        return;
+      lock = std::unique_lock<std::mutex>(executor->bindMutex);
+      threadLocalBoundExecutor() = executor;
+      threadLocalWorkerDeque() = executor->workerDeques[0].get();
+    }
+
+    ~ScopedBinding() {
+      if (!lock.owns_lock()) return;
+      threadLocalBoundExecutor() = prevBoundExecutor;
+      threadLocalWorkerDeque() = prevWorkerDeque;
+    }
+
+    ScopedBinding(const ScopedBinding&) = delete;
+    ScopedBinding& operator=(const ScopedBinding&) = delete;
+  };
+
+  // Statistics of each worker of the executor used by the calling
+  // thread, which are approximate while it has tasks running
+  static std::vector<HighsSplitDeque::WorkerStats> getWorkerStats() {
+    std::vector<HighsSplitDeque::WorkerStats> stats;
+    HighsSplitDeque* localDeque = threadLocalWorkerDeque();
+    if (!isInitialized() || !localDeque) return stats;
+    for (int i = 0; i < localDeque->getNumWorkers(); ++i)
+      stats.push_back(localDeque->getWorkerById(i)->getStats());
+    return stats;
+  }
+
+  static void resetWorkerStats() {
+    HighsSplitDeque* localDeque = threadLocalWorkerDeque();
+    if (!isInitialized() || !localDeque) return;
+    for (int i = 0; i < localDeque->getNumWorkers(); ++i)
+      localDeque->getWorkerById(i)->resetStats();
+  }
+
   static void shutdown(bool blocking = false) {
-    auto& executorHandle = threadLocalExecutorHandle();
+    shutdown(threadLocalExecutorHandle(), blocking);
+  }
+
+  static void shutdown(ExecutorHandle& executorHandle, bool blocking = false) {
     if (executorHandle.ptr) {
       // first spin until every worker has acquired its executor reference
       while (executorHandle.ptr.use_count() !=
@@ -192,7 +354,7 @@ class HighsTaskExecutor {
                 std::chrono::high_resolution_clock::now() - tStart)
                 .count();
 
-        if (numMicroSecs < HighsSchedulerConstants::kMicroSecsBeforeSleep)
+        if (numMicroSecs < localDeque->getSpinMicroSecs())
           numTries *= 2;
         else
           break;
@@ -0,0 +1,154 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file parallel/HighsWorkerPlacement.cpp
+ * @brief
+ */
+#include "parallel/HighsWorkerPlacement.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// CPUs claimed by the placements of all executors in the process
+std::mutex& claimedCpuMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::set<int>& claimedCpus() {
+  static std::set<int> cpus;
+  return cpus;
+}
+
+#ifdef __linux__
+// Parse a list of CPUs such as "0-3,8,10-11", as found in sysfs
+std::vector<int> parseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") continue;
+    const std::size_t dash = range.find('-');
+    const int first = std::atoi(range.c_str());
+    const int last =
+        dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+    for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+// CPUs available to the process, grouped by NUMA node
+std::vector<std::vector<int>> availableCpusByNode() {
+  std::vector<std::vector<int>> nodes;
+  cpu_set_t available;
+  CPU_ZERO(&available);
+  if (sched_getaffinity(0, sizeof(available), &available) != 0) return nodes;
+  auto isAvailable = [&](int cpu) {
+    return cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &available);
+  };
+  // Node numbers may not be contiguous, so give up only after a run
+  // of missing nodes
+  const int kMaxMissingNode = 64;
+  int num_missing = 0;
+  for (int node = 0; num_missing < kMaxMissingNode; node++) {
+    std::ifstream file("/sys/devices/system/node/node" +
+                       std::to_string(node) + "/cpulist");
+    if (!file) {
+      num_missing++;
+      continue;
+    }
+    num_missing = 0;
+    std::string list;
+    std::getline(file, list);
+    std::vector<int> cpus;
+    for (const int cpu : parseCpuList(list))
+      if (isAvailable(cpu)) cpus.push_back(cpu);
+    if (!cpus.empty()) nodes.push_back(std::move(cpus));
+  }
+  if (nodes.empty()) {
+    // No NUMA information, so treat the machine as a single node
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+      if (isAvailable(cpu)) cpus.push_back(cpu);
+    if (!cpus.empty()) nodes.push_back(std::move(cpus));
+  }
+  return nodes;
+}
+#endif
+
+}  // namespace
+
+void HighsWorkerPlacement::setup(int numWorkers) {
+  release();
+  group_begin_.assign(numWorkers, 0);
+  group_end_.assign(numWorkers, numWorkers);
+#ifdef __linux__
+  const std::vector<std::vector<int>> nodes = availableCpusByNode();
+  if (nodes.empty() || numWorkers <= 0) return;
+  std::lock_guard<std::mutex> lock(claimedCpuMutex());
+  std::set<int>& claimed = claimedCpus();
+  std::vector<int> node_of_worker;
+  for (const std::vector<int>& cpus : nodes) {
+    for (const int cpu : cpus) {
+      if ((int)cpu_.size() == numWorkers) break;
+      if (claimed.count(cpu)) continue;
+      cpu_.push_back(cpu);
+      node_of_worker.push_back(&cpus - nodes.data());
+    }
+  }
+  if ((int)cpu_.size() < numWorkers) {
+    // Not enough unclaimed CPUs, so the workers aren't pinned
+    cpu_.clear();
+    return;
+  }
+  claimed.insert(cpu_.begin(), cpu_.end());
+  // Workers on the same node have consecutive ids
+  for (int iWorker = 0; iWorker < numWorkers; iWorker++) {
+    int begin = iWorker;
+    while (begin > 0 && node_of_worker[begin - 1] == node_of_worker[iWorker])
+      begin--;
+    int end = iWorker + 1;
+    while (end < numWorkers && node_of_worker[end] == node_of_worker[iWorker])
+      end++;
+    group_begin_[iWorker] = begin;
+    group_end_[iWorker] = end;
+  }
+#endif
+}
+
+void HighsWorkerPlacement::release() {
+  if (cpu_.empty()) return;
+  std::lock_guard<std::mutex> lock(claimedCpuMutex());
+  for (const int cpu : cpu_) claimedCpus().erase(cpu);
+  cpu_.clear();
+}
+
+bool HighsWorkerPlacement::pinThisThread(int workerId) const {
+  if (workerId < 0 || workerId >= (int)cpu_.size()) return false;
+#ifdef __linux__
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu_[workerId], &cpus);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif
+}
@@ -0,0 +1,67 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file parallel/HighsWorkerPlacement.h
+ * @brief Placement of task executor workers on CPUs and NUMA nodes
+ *
+ * Workers are placed compactly: the CPUs of the first NUMA node are
+ * used before those of the next, so that a small executor stays on
+ * one node. Workers on the same node have consecutive ids, forming
+ * the group from which a worker tries to steal first. Where the
+ * topology can't be determined, all workers form a single group and
+ * no thread is pinned.
+ *
+ * A placement claims its CPUs for the process until it is destroyed
+ * or set up again, so executors that exist at the same time are
+ * placed on different CPUs. If there are fewer unclaimed CPUs than
+ * workers, no CPU is claimed and no thread is pinned, since workers
+ * sharing CPUs with those of another executor are slower than
+ * unpinned workers.
+ */
+#ifndef PARALLEL_HIGHS_WORKER_PLACEMENT_H_
+#define PARALLEL_HIGHS_WORKER_PLACEMENT_H_
+
+#include <vector>
+
+class HighsWorkerPlacement {
+ public:
+  HighsWorkerPlacement() = default;
+  ~HighsWorkerPlacement() { release(); }
+  HighsWorkerPlacement(const HighsWorkerPlacement&) = delete;
+  HighsWorkerPlacement& operator=(const HighsWorkerPlacement&) = delete;
+
+  // Place numWorkers workers on the CPUs available to the process
+  // that aren't claimed by another placement
+  void setup(int numWorkers);
+
+  bool empty() const { return cpu_.empty(); }
+
+  // CPU of the given worker
+  int cpu(int workerId) const { return cpu_[workerId]; }
+
+  // First and (one beyond) last worker placed on the same NUMA node
+  // as the given worker
+  int groupBegin(int workerId) const { return group_begin_[workerId]; }
+  int groupEnd(int workerId) const { return group_end_[workerId]; }
+
+  // Pin the calling thread to the CPU of the given worker, returning
+  // false if this is not possible
+  bool pinThisThread(int workerId) const;
+
+ private:
+  // Return the CPUs of the placement to the unclaimed CPUs
+  void release();
+
+  std::vector<int> cpu_;
+  std::vector<int> group_begin_;
+  std::vector<int> group_end_;
+};
+
+#endif
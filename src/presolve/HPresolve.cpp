@@ -33,6 +33,7 @@
 #include "util/HighsIntegers.h"
 #include "util/HighsLinearSumBounds.h"
 #include "util/HighsSplay.h"
+#include "util/HighsTrace.h"
 #include "util/HighsUtils.h"
 
 #define ENABLE_SPARSIFY_FOR_LP 0
@@ -98,12 +99,10 @@ void HPresolve::setInput(HighsLp& model_, const HighsOptions& options_,
   } else
     primal_feastol = options->mip_feasibility_tolerance;
 
-  if (model_.a_matrix_.isRowwise())
-    fromCSR(model->a_matrix_.value_, model->a_matrix_.index_,
-            model->a_matrix_.start_);
-  else
-    fromCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-            model->a_matrix_.start_);
+  // move the constraint matrix into the internal storage so that the model
+  // does not hold a second copy of it while presolve runs. The matrix of the
+  // model is written back by toCSC() once presolve is finished
+  moveModelMatrixToStorage();
 
   // initialize everything as changed, but do not add all indices
   // since the first thing presolve will do is a scan for easy reductions
@@ -879,6 +878,7 @@ void HPresolve::shrinkProblem(HighsPostsolveStack& postsolve_stack) {
 
 HPresolve::Result HPresolve::dominatedColumns(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "dominatedColumns");
   std::vector<std::pair<uint32_t, uint32_t>> signatures(model->num_col_);
 
   auto isBinary = [&](HighsInt i) {
@@ -1269,13 +1269,20 @@ HPresolve::Result HPresolve::dominatedColumns(
 }
 
 HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "runProbing");
   probingEarlyAbort = false;
   if (numDeletedCols + numDeletedRows != 0) shrinkProblem(postsolve_stack);
 
+  // domain propagation works on the column-wise matrix of the model, so it
+  // is written back from the compacted storage, and released once probing
+  // has finished
+  rebuildStorage();
   toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
         model->a_matrix_.start_);
-  fromCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-          model->a_matrix_.start_);
+  // toCSC() counts the column sizes down to zero, so restore them from the
+  // column starts written back to the model
+  for (HighsInt i = 0; i != model->num_col_; ++i)
+    colsize[i] = model->a_matrix_.start_[i + 1] - model->a_matrix_.start_[i];
 
   mipsolver->mipdata_->cliquetable.setMaxEntries(numNonzeros());
 
@@ -1378,9 +1385,19 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
         std::max(mipsolver->submip ? HighsInt{0} : HighsInt{100000},
                  10 * numNonzeros());
     HighsInt numFail = 0;
-    for (const std::tuple<int64_t, HighsInt, HighsInt, HighsInt>& binvar :
-         binaries) {
-      HighsInt i = std::get<3>(binvar);
+
+    // when probing in batches, the binaries of a batch are probed in parallel
+    // on copies of the global domain and the results are applied in the
+    // order of the binaries. Each chunk of a batch is probed on its own copy,
+    // which makes the result independent of the number of threads
+    constexpr HighsInt kProbingChunkSize = 16;
+    const HighsInt probingBatchSize = options->mip_probing_batch_size;
+    std::vector<HighsInt> batchCols;
+    std::vector<HighsImplications::ProbingResult> batchResults;
+    size_t batchStart = 0;
+    size_t batchEnd = 0;
+    for (size_t k = 0; k != binaries.size(); ++k) {
+      HighsInt i = std::get<3>(binaries[k]);
 
       if (cliquetable.getSubstitution(i) != nullptr) continue;
 
@@ -1414,9 +1431,34 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
 
         if (probingContingent - numProbed < 0) break;
 
+        HighsImplications::ProbingResult* probingResult = nullptr;
+        if (probingBatchSize > 0) {
+          if (k >= batchEnd) {
+            domain.propagate();
+            if (domain.infeasible()) return Result::kPrimalInfeasible;
+
+            batchStart = k;
+            batchEnd = std::min(binaries.size(), k + probingBatchSize);
+            batchCols.clear();
+            for (size_t j = batchStart; j != batchEnd; ++j) {
+              HighsInt col = std::get<3>(binaries[j]);
+              bool probeCol = domain.isBinary(col) &&
+                              !implications.implicationsCached(col, 1) &&
+                              !implications.implicationsCached(col, 0) &&
+                              cliquetable.getSubstitution(col) == nullptr;
+              batchCols.push_back(probeCol ? col : -1);
+            }
+            batchResults.clear();
+            implications.probeBatch(batchCols, batchResults,
+                                    kProbingChunkSize);
+          }
+          if (batchCols[k - batchStart] == i)
+            probingResult = &batchResults[k - batchStart];
+        }
+
         HighsInt numBoundChgs = 0;
         HighsInt numNewCliques = -cliquetable.numCliques();
-        if (!implications.runProbing(i, numBoundChgs)) continue;
+        if (!implications.runProbing(i, numBoundChgs, probingResult)) continue;
         probingContingent += numBoundChgs;
         numNewCliques += cliquetable.numCliques();
         numNewCliques = std::max(numNewCliques, HighsInt{0});
@@ -1946,9 +1988,9 @@ HighsTripletPositionSlice HPresolve::getStoredRow() const {
                                    rowpositions.data(), rowpositions.size());
 }
 
-void HPresolve::fromCSC(const std::vector<double>& Aval,
-                        const std::vector<HighsInt>& Aindex,
-                        const std::vector<HighsInt>& Astart) {
+void HPresolve::fromCSC(std::vector<double>&& Aval,
+                        std::vector<HighsInt>&& Aindex,
+                        std::vector<HighsInt>&& Astart) {
   Avalue.clear();
   Acol.clear();
   Arow.clear();
@@ -1977,16 +2019,17 @@ void HPresolve::fromCSC(const std::vector<double>& Aval,
   assert(ncol == int(colhead.size()));
   HighsInt nnz = Aval.size();
 
-  Avalue = Aval;
+  // the values and row indices are taken over as they are and the column
+  // starts are released once the column indices are set up
+  Avalue = std::move(Aval);
+  Arow = std::move(Aindex);
   Acol.reserve(nnz);
-  Arow.reserve(nnz);
 
   for (HighsInt i = 0; i != ncol; ++i) {
     HighsInt collen = Astart[i + 1] - Astart[i];
     Acol.insert(Acol.end(), collen, i);
-    Arow.insert(Arow.end(), Aindex.begin() + Astart[i],
-                Aindex.begin() + Astart[i + 1]);
   }
+  std::vector<HighsInt>().swap(Astart);
 
   Anext.resize(nnz);
   Aprev.resize(nnz);
@@ -2004,9 +2047,9 @@ void HPresolve::fromCSC(const std::vector<double>& Aval,
   }
 }
 
-void HPresolve::fromCSR(const std::vector<double>& ARval,
-                        const std::vector<HighsInt>& ARindex,
-                        const std::vector<HighsInt>& ARstart) {
+void HPresolve::fromCSR(std::vector<double>&& ARval,
+                        std::vector<HighsInt>&& ARindex,
+                        std::vector<HighsInt>&& ARstart) {
   Avalue.clear();
   Acol.clear();
   Arow.clear();
@@ -2035,17 +2078,15 @@ void HPresolve::fromCSR(const std::vector<double>& ARval,
   assert(nrow == int(rowroot.size()));
   HighsInt nnz = ARval.size();
 
-  Avalue = ARval;
-  Acol.reserve(nnz);
+  Avalue = std::move(ARval);
+  Acol = std::move(ARindex);
   Arow.reserve(nnz);
-  //  entries.reserve(nnz);
 
   for (HighsInt i = 0; i != nrow; ++i) {
     HighsInt rowlen = ARstart[i + 1] - ARstart[i];
     Arow.insert(Arow.end(), rowlen, i);
-    Acol.insert(Acol.end(), ARindex.begin() + ARstart[i],
-                ARindex.begin() + ARstart[i + 1]);
   }
+  std::vector<HighsInt>().swap(ARstart);
 
   Anext.resize(nnz);
   Aprev.resize(nnz);
@@ -2342,6 +2383,31 @@ void HPresolve::substitute(HighsInt row, HighsInt col, double rhs) {
   for (HighsInt rowiter : rowpositions) unlink(rowiter);
 }
 
+void HPresolve::moveModelMatrixToStorage() {
+  HighsSparseMatrix& a_matrix = model->a_matrix_;
+  if (a_matrix.isRowwise())
+    fromCSR(std::move(a_matrix.value_), std::move(a_matrix.index_),
+            std::move(a_matrix.start_));
+  else
+    fromCSC(std::move(a_matrix.value_), std::move(a_matrix.index_),
+            std::move(a_matrix.start_));
+  resetModelMatrix();
+}
+
+void HPresolve::resetModelMatrix() {
+  HighsSparseMatrix& a_matrix = model->a_matrix_;
+  a_matrix.format_ = MatrixFormat::kColwise;
+  a_matrix.start_.assign(model->num_col_ + 1, 0);
+  std::vector<HighsInt>().swap(a_matrix.index_);
+  std::vector<double>().swap(a_matrix.value_);
+}
+
+void HPresolve::rebuildStorage() {
+  toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
+        model->a_matrix_.start_);
+  moveModelMatrixToStorage();
+}
+
 void HPresolve::toCSC(std::vector<double>& Aval, std::vector<HighsInt>& Aindex,
                       std::vector<HighsInt>& Astart) {
   // set up the column starts using the column size array
@@ -3985,6 +4051,7 @@ HPresolve::Result HPresolve::colPresolve(HighsPostsolveStack& postsolve_stack,
 
 HPresolve::Result HPresolve::initialRowAndColPresolve(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "initialRowAndColPresolve");
   // do a full scan over the rows as the singleton arrays and the changed row
   // arrays are not initialized, also unset changedRowFlag so that the row will
   // be added to the changed row vector when it is changed after it was
@@ -4014,6 +4081,7 @@ HPresolve::Result HPresolve::initialRowAndColPresolve(
 
 HPresolve::Result HPresolve::fastPresolveLoop(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "fastPresolveLoop");
   do {
     storeCurrentProblemSize();
 
@@ -4150,10 +4218,7 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
                                      numDeletedRows >= 0.5 * model->num_row_)) {
           shrinkProblem(postsolve_stack);
 
-          toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-                model->a_matrix_.start_);
-          fromCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-                  model->a_matrix_.start_);
+          rebuildStorage();
         }
         storeCurrentProblemSize();
         HPRESOLVE_CHECKED_CALL(detectParallelRowsAndCols(postsolve_stack));
@@ -4186,6 +4251,7 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
         detectImpliedIntegers();
         storeCurrentProblemSize();
         HPRESOLVE_CHECKED_CALL(runProbing(postsolve_stack));
+        resetModelMatrix();
         tryProbing = probingContingent > numProbed &&
                      (problemSizeReduction() > 1.0 || probingEarlyAbort);
         trySparsify = true;
@@ -4198,10 +4264,7 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
                                      numDeletedRows >= 0.5 * model->num_row_)) {
           shrinkProblem(postsolve_stack);
 
-          toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-                model->a_matrix_.start_);
-          fromCSC(model->a_matrix_.value_, model->a_matrix_.index_,
-                  model->a_matrix_.start_);
+          rebuildStorage();
         }
         storeCurrentProblemSize();
         if (analysis_.allow_rule_[kPresolveRuleDependentEquations]) {
@@ -4325,9 +4388,15 @@ HighsModelStatus HPresolve::run(HighsPostsolveStack& postsolve_stack) {
     case Result::kOk:
       break;
     case Result::kPrimalInfeasible:
+      // write back the matrix, since the model is left in a consistent
+      // state, even though presolve has not finished
+      toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
+            model->a_matrix_.start_);
       presolve_status_ = HighsPresolveStatus::kInfeasible;
       return HighsModelStatus::kInfeasible;
     case Result::kDualInfeasible:
+      toCSC(model->a_matrix_.value_, model->a_matrix_.index_,
+            model->a_matrix_.start_);
       presolve_status_ = HighsPresolveStatus::kUnboundedOrInfeasible;
       return HighsModelStatus::kUnboundedOrInfeasible;
   }
@@ -4443,6 +4512,7 @@ void HPresolve::computeIntermediateMatrix(std::vector<HighsInt>& flagRow,
 
 HPresolve::Result HPresolve::removeDependentEquations(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "removeDependentEquations");
   assert(analysis_.allow_rule_[kPresolveRuleDependentEquations]);
   const bool logging_on = analysis_.logging_on_;
   if (equations.empty()) return Result::kOk;
@@ -4546,6 +4616,7 @@ HPresolve::Result HPresolve::removeDependentEquations(
 
 HPresolve::Result HPresolve::removeDependentFreeCols(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "removeDependentFreeCols");
   return Result::kOk;
 
   // Commented out unreachable code
@@ -4636,6 +4707,7 @@ HPresolve::Result HPresolve::removeDependentFreeCols(
 }
 
 HPresolve::Result HPresolve::aggregator(HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "aggregator");
   assert(analysis_.allow_rule_[kPresolveRuleAggregator]);
   const bool logging_on = analysis_.logging_on_;
   if (logging_on) analysis_.startPresolveRuleLog(kPresolveRuleAggregator);
@@ -5108,6 +5180,7 @@ HPresolve::Result HPresolve::removeDoubletonEquations(
 }
 
 HighsInt HPresolve::strengthenInequalities() {
+  HighsTraceScope trace("presolve", "strengthenInequalities");
   std::vector<int8_t> complementation;
   std::vector<double> reducedcost;
   std::vector<double> upper;
@@ -5336,6 +5409,7 @@ HighsInt HPresolve::strengthenInequalities() {
 }
 
 HighsInt HPresolve::detectImpliedIntegers() {
+  HighsTraceScope trace("presolve", "detectImpliedIntegers");
   HighsInt numImplInt = 0;
 
   for (HighsInt col = 0; col != model->num_col_; ++col) {
@@ -5361,6 +5435,7 @@ HighsInt HPresolve::detectImpliedIntegers() {
 
 HPresolve::Result HPresolve::detectParallelRowsAndCols(
     HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "detectParallelRowsAndCols");
   assert(analysis_.allow_rule_[kPresolveRuleParallelRowsAndCols]);
   const bool logging_on = analysis_.logging_on_;
   if (logging_on)
@@ -6385,6 +6460,7 @@ void HPresolve::debug(const HighsLp& lp, const HighsOptions& options) {
 }
 
 HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
+  HighsTraceScope trace("presolve", "sparsify");
   std::vector<HighsPostsolveStack::Nonzero> sparsifyRows;
   HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
   HPRESOLVE_CHECKED_CALL(removeDoubletonEquations(postsolve_stack));
@@ -6636,11 +6712,12 @@ HighsInt HPresolve::debugGetCheckCol() const {
   HighsInt check_col = -1;
   if (check_col_name == "") return check_col;
   if (model->col_names_.size()) {
-    if (HighsInt(model->col_hash_.name2index.size()) != model->num_col_)
+    if (model->col_hash_.size() != model->num_col_)
       model->col_hash_.form(model->col_names_);
-    auto search = model->col_hash_.name2index.find(check_col_name);
-    if (search != model->col_hash_.name2index.end()) {
-      check_col = search->second;
+    const HighsInt search =
+        model->col_hash_.find(model->col_names_, check_col_name);
+    if (search >= 0) {
+      check_col = search;
       assert(model->col_names_[check_col] == check_col_name);
     }
   }
@@ -6652,11 +6729,12 @@ HighsInt HPresolve::debugGetCheckRow() const {
   HighsInt check_row = -1;
   if (check_row_name == "") return check_row;
   if (model->row_names_.size()) {
-    if (HighsInt(model->row_hash_.name2index.size()) != model->num_row_)
+    if (model->row_hash_.size() != model->num_row_)
       model->row_hash_.form(model->row_names_);
-    auto search = model->row_hash_.name2index.find(check_row_name);
-    if (search != model->row_hash_.name2index.end()) {
-      check_row = search->second;
+    const HighsInt search =
+        model->row_hash_.find(model->row_names_, check_row_name);
+    if (search >= 0) {
+      check_row = search;
       assert(model->row_names_[check_row] == check_row_name);
     }
   }
@@ -185,13 +185,23 @@ class HPresolve {
 
   HighsInt findNonzero(HighsInt row, HighsInt col);
 
-  void fromCSC(const std::vector<double>& Aval,
-               const std::vector<HighsInt>& Aindex,
-               const std::vector<HighsInt>& Astart);
+  // build the internal storage taking over the given vectors, which are
+  // released as they are consumed
+  void fromCSC(std::vector<double>&& Aval, std::vector<HighsInt>&& Aindex,
+               std::vector<HighsInt>&& Astart);
 
-  void fromCSR(const std::vector<double>& ARval,
-               const std::vector<HighsInt>& ARindex,
-               const std::vector<HighsInt>& ARstart);
+  void fromCSR(std::vector<double>&& ARval, std::vector<HighsInt>&& ARindex,
+               std::vector<HighsInt>&& ARstart);
+
+  // move the matrix of the model into the internal storage, leaving the
+  // model with an empty column-wise matrix until toCSC() writes it back
+  void moveModelMatrixToStorage();
+
+  // leave the model with an empty column-wise matrix, releasing its memory
+  void resetModelMatrix();
+
+  // rebuild the internal storage without the slots of deleted nonzeros
+  void rebuildStorage();
 
   void toCSC(std::vector<double>& Aval, std::vector<HighsInt>& Aindex,
              std::vector<HighsInt>& Astart);
@@ -16,6 +16,7 @@
 #include "presolve/HighsSymmetry.h"
 
 #include <algorithm>
+#include <chrono>
 #include <numeric>
 
 #include "mip/HighsCliqueTable.h"
@@ -797,16 +798,43 @@ HighsInt HighsSymmetryDetection::getOrbit(HighsInt vertex) {
 }
 
 void HighsSymmetryDetection::initializeHashValues() {
+  // The graph is stored with both directions of each edge and the hash
+  // contributions are combined additively, so the hash value of each vertex
+  // can be computed independently from its own adjacency list. This allows to
+  // compute the hash values for the initial refinement in parallel and only
+  // insert them into the hash table sequentially afterwards.
+  std::vector<u32> initialHash(numVertices);
+  highs::parallel::for_each(
+      0, numVertices,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt i = start; i != end; ++i) {
+          u32 hash = 0;
+          for (HighsInt j = Gstart[i]; j != Gend[i]; ++j)
+            HighsHashHelpers::sparse_combine32(
+                hash, vertexToCell[Gedge[j].first], Gedge[j].second);
+          initialHash[i] = hash;
+        }
+      },
+      1024);
+
   for (HighsInt i = 0; i != numVertices; ++i) {
-    HighsInt cell = vertexToCell[i];
-    for (HighsInt j = Gstart[i]; j != Gend[i]; ++j) {
-      HighsHashHelpers::sparse_combine32(vertexHash[Gedge[j].first], cell,
-                                         Gedge[j].second);
-    }
-    markCellForRefinement(cell);
+    if (Gstart[i] != Gend[i]) vertexHash[i] = initialHash[i];
+    markCellForRefinement(vertexToCell[i]);
   }
 }
 
+bool HighsSymmetryDetection::stopTimeReached() const {
+  double stop = stopTime.load(std::memory_order_relaxed);
+  if (stop == kHighsInf) return false;
+
+  using namespace std::chrono;
+  double wallTime =
+      duration_cast<duration<double> >(
+          high_resolution_clock::now().time_since_epoch())
+          .count();
+  return wallTime > stop;
+}
+
 bool HighsSymmetryDetection::updateCellMembership(HighsInt i, HighsInt cell,
                                                   bool markForRefinement) {
   HighsInt vertex = currentPartition[i];
@@ -1693,7 +1721,15 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
   createNode();
   HighsInt maxPerms = 64000000 / numActiveCols;
   HighsSplitDeque* workerDeque = HighsTaskExecutor::getThisWorkerDeque();
+  numSearchNodes = 0;
+  searchStopped = false;
   while (!nodeStack.empty()) {
+    // every permutation stored so far is an automorphism, hence the search can
+    // be stopped at any node when it takes too long
+    if ((++numSearchNodes & 63) == 0 && stopTimeReached()) {
+      searchStopped = true;
+      break;
+    }
     HighsInt targetCell = selectTargetCell();
     if (targetCell == -1) {
       if (firstLeavePartition.empty()) {
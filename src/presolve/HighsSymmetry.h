@@ -17,6 +17,7 @@
 #define PRESOLVE_HIGHS_SYMMETRY_H_
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -185,6 +186,7 @@ class HighsSymmetryDetection {
   HighsInt bestPathDepth;
 
   HighsInt numAutomorphisms;
+  HighsInt numSearchNodes;
   HighsInt numCol;
   HighsInt numRow;
   HighsInt numVertices;
@@ -200,6 +202,11 @@ class HighsSymmetryDetection {
 
   std::vector<Node> nodeStack;
 
+  // wall clock time after which the search for automorphisms is stopped. It
+  // can be set from a different thread while the search is running
+  std::atomic<double> stopTime{kHighsInf};
+  bool searchStopped = false;
+
   HighsInt getCellStart(HighsInt pos);
 
   void backtrack(HighsInt backtrackStackNewEnd, HighsInt backtrackStackEnd);
@@ -219,6 +226,7 @@ class HighsSymmetryDetection {
   HighsInt getOrbit(HighsInt vertex);
 
   void initializeHashValues();
+  bool stopTimeReached() const;
   bool isomorphicToFirstLeave();
   bool partitionRefinement();
   bool checkStoredAutomorphism(HighsInt vertex);
@@ -279,6 +287,15 @@ class HighsSymmetryDetection {
   bool initializeDetection();
 
   void run(HighsSymmetries& symmetries);
+
+  /// set the wall clock time at which a running search is stopped, the
+  /// generators found until then remain valid
+  void setStopTime(double wallTime) {
+    stopTime.store(wallTime, std::memory_order_relaxed);
+  }
+
+  /// whether the last search was stopped before it was completed
+  bool wasStopped() const { return searchStopped; }
 };
 
 #endif
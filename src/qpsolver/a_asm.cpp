@@ -12,6 +12,8 @@ QpAsmStatus solveqp_actual(Instance& instance, Settings& settings, QpHotstartInf
   quass.solve(startinfo.primal, startinfo.rowact, basis, qp_timer);
 
   status = rt.status;
+  // The runtime has a copy of the statistics, so return them
+  stats = rt.statistics;
 
   solution.status_var = rt.status_var;
   solution.status_con = rt.status_con;
@@ -23,6 +23,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HSimplexReport.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsTrace.h"
 
 using std::fabs;
 using std::max;
@@ -2033,13 +2034,16 @@ bool HEkk::rebuildRefactor(HighsInt rebuild_reason) {
 HighsInt HEkk::computeFactor() {
   assert(status_.has_nla);
   if (status_.has_fresh_invert) return 0;
+  HighsTraceScope trace("factor", "INVERT");
   // Clear any bad basis changes
   clearBadBasisChange();
   highsAssert(lpFactorRowCompatible(),
               "HEkk::computeFactor: lpFactorRowCompatible");
   // Perform INVERT
   analysis_.simplexTimerStart(InvertClock);
+  const int64_t invert_start = metrics_ ? HighsMetrics::now() : 0;
   const HighsInt rank_deficiency = simplex_nla_.invert();
+  if (metrics_) metrics_->recordInvert(HighsMetrics::now() - invert_start);
   analysis_.simplexTimerStop(InvertClock);
   //
   // Set up hot start information
@@ -2791,6 +2795,7 @@ void HEkk::pivotColumnFtran(const HighsInt iCol, HVector& col_aq) {
   HighsInt num_row = lp_.num_row_;
   const double local_col_aq_density = (double)col_aq.count / num_row;
   updateOperationResultDensity(local_col_aq_density, info_.col_aq_density);
+  if (metrics_) metrics_->recordFtranDensity(local_col_aq_density);
   analysis_.simplexTimerStop(FtranClock);
 }
 
@@ -2850,6 +2855,7 @@ void HEkk::choosePriceTechnique(const HighsInt price_strategy,
 void HEkk::tableauRowPrice(const bool quad_precision, const HVector& row_ep,
                            HVector& row_ap, const HighsInt debug_report) {
   analysis_.simplexTimerStart(PriceClock);
+  HighsTraceScope trace("simplex", "PRICE");
   const HighsInt solver_num_row = lp_.num_row_;
   const HighsInt solver_num_col = lp_.num_col_;
   const double local_density = 1.0 * row_ep.count / solver_num_row;
@@ -3111,6 +3117,7 @@ void HEkk::updatePivots(const HighsInt variable_in, const HighsInt row_out,
                         const HighsInt move_out) {
   analysis_.simplexTimerStart(UpdatePivotsClock);
   HighsInt variable_out = basis_.basicIndex_[row_out];
+  if (metrics_) metrics_->recordSimplexIteration();
 
   // update hash value of basis
   HighsHashHelpers::sparse_inverse_combine(basis_.hash, variable_out);
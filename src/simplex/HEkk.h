@@ -15,8 +15,10 @@
 #define SIMPLEX_HEKK_H_
 
 #include "lp_data/HighsCallback.h"
+#include "lp_data/HighsMetrics.h"
 #include "simplex/HSimplexNla.h"
 #include "simplex/HighsSimplexAnalysis.h"
+#include "simplex/HighsSimplexWorkspace.h"
 #include "util/HSet.h"
 #include "util/HighsHash.h"
 #include "util/HighsRandom.h"
@@ -25,7 +27,7 @@ class HighsLpSolverObject;
 
 class HEkk {
  public:
-  HEkk() {}
+  HEkk() : workspace_(std::make_shared<HighsSimplexWorkspace>()) {}
   /**
    * @brief Interface to simplex solvers
    */
@@ -153,6 +155,11 @@ class HEkk {
   HighsSparseMatrix ar_matrix_;
   HighsSparseMatrix scaled_a_matrix_;
   HSimplexNla simplex_nla_;
+  // Storage for the vectors of the simplex solvers, kept between
+  // solves and possibly shared with other instances
+  std::shared_ptr<HighsSimplexWorkspace> workspace_;
+  // Live metrics to be updated, or nullptr
+  HighsMetrics* metrics_ = nullptr;
   HotStart hot_start_;
 
   double cost_scale_ = 1;
@@ -25,6 +25,7 @@
 #include "parallel/HighsParallel.h"
 #include "simplex/HEkkPrimal.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsTrace.h"
 
 using std::fabs;
 
@@ -395,6 +396,17 @@ HighsStatus HEkkDual::solve(const bool pass_force_phase2) {
   return ekk_instance_.returnFromSolve(HighsStatus::kOk);
 }
 
+HEkkDual::~HEkkDual() {
+  HighsSimplexWorkspace& workspace = *ekk_instance_.workspace_;
+  workspace.release(col_DSE);
+  workspace.release(col_BFRT);
+  workspace.release(col_aq);
+  workspace.release(row_ep);
+  workspace.release(row_ap);
+  workspace.release(dev_row_ep);
+  workspace.release(dev_col_DSE);
+}
+
 void HEkkDual::initialiseInstance() {
   // Called in constructor for HEkkDual class
   // Copy size, matrix and simplex NLA
@@ -416,15 +428,16 @@ void HEkkDual::initialiseInstance() {
   baseUpper = ekk_instance_.info_.baseUpper_.data();
   baseValue = ekk_instance_.info_.baseValue_.data();
 
-  // Setup local vectors
-  col_DSE.setup(solver_num_row);
-  col_BFRT.setup(solver_num_row);
-  col_aq.setup(solver_num_row);
-  row_ep.setup(solver_num_row);
-  row_ap.setup(solver_num_col);
+  // Setup local vectors, drawing their storage from the workspace
+  HighsSimplexWorkspace& workspace = *ekk_instance_.workspace_;
+  workspace.acquire(col_DSE, solver_num_row);
+  workspace.acquire(col_BFRT, solver_num_row);
+  workspace.acquire(col_aq, solver_num_row);
+  workspace.acquire(row_ep, solver_num_row);
+  workspace.acquire(row_ap, solver_num_col);
 
-  dev_row_ep.setup(solver_num_row);
-  dev_col_DSE.setup(solver_num_row);
+  workspace.acquire(dev_row_ep, solver_num_row);
+  workspace.acquire(dev_col_DSE, solver_num_row);
 
   // Setup other buffers
   dualRow.setup();
@@ -1425,13 +1438,16 @@ void HEkkDual::chooseRow() {
   std::vector<double>& edge_weight = ekk_instance_.dual_edge_weight_;
   for (;;) {
     // Choose the index of a good row to leave the basis
+    HighsTraceScope trace_chuzr("simplex", "CHUZR");
     dualRHS.chooseNormal(&row_out);
+    trace_chuzr.stop();
     if (row_out == kNoRowChosen) {
       // No index found so may be dual optimal.
       rebuild_reason = kRebuildReasonPossiblyOptimal;
       return;
     }
     // Compute pi_p = B^{-T}e_p in row_ep
+    HighsTraceScope trace_btran("simplex", "BTRAN");
     analysis->simplexTimerStart(BtranClock);
     // Set up RHS for BTRAN
     row_ep.clear();
@@ -1448,6 +1464,7 @@ void HEkkDual::chooseRow() {
     if (analysis->analyse_simplex_summary_data)
       analysis->operationRecordAfter(kSimplexNlaBtranEp, row_ep);
     analysis->simplexTimerStop(BtranClock);
+    trace_btran.stop();
     // Verify DSE weight
     if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
       // For DSE, see how accurate the updated weight is
@@ -1582,6 +1599,7 @@ void HEkkDual::chooseColumn(HVector* row_ep) {
   //
   // CHUZC
   //
+  HighsTraceScope trace_chuzc("simplex", "CHUZC");
   // Section 0: Clear data and call createFreemove to set a value of
   // nonbasicMove for all free columns to prevent their dual values
   // from being changed.
@@ -1946,6 +1964,7 @@ void HEkkDual::updateFtran() {
   //
   // If reinversion is needed then skip this method
   if (rebuild_reason) return;
+  HighsTraceScope trace("simplex", "FTRAN");
   analysis->simplexTimerStart(FtranClock);
   // Clear the pivotal column and indicate that its values should be packed
   col_aq.clear();
@@ -1964,6 +1983,8 @@ void HEkkDual::updateFtran() {
   const double local_col_aq_density = (double)col_aq.count / solver_num_row;
   ekk_instance_.updateOperationResultDensity(
       local_col_aq_density, ekk_instance_.info_.col_aq_density);
+  if (ekk_instance_.metrics_)
+    ekk_instance_.metrics_->recordFtranDensity(local_col_aq_density);
   // Save the pivot value computed column-wise - used for numerical checking
   alpha_col = col_aq.array[row_out];
   analysis->simplexTimerStop(FtranClock);
@@ -1974,6 +1995,7 @@ void HEkkDual::updateFtranBFRT() {
   //
   // If reinversion is needed then skip this method
   if (rebuild_reason) return;
+  HighsTraceScope trace("simplex", "FTRAN-BFRT");
 
   // Only time updateFtranBFRT if dualRow.workCount > 0;
   // If dualRow.workCount = 0 then dualRow.updateFlip(&col_BFRT)
@@ -2028,6 +2050,7 @@ void HEkkDual::updateFtranDSE(HVector* DSE_Vector) {
   //
   // If reinversion is needed then skip this method
   if (rebuild_reason) return;
+  HighsTraceScope trace("simplex", "FTRAN-DSE");
   analysis->simplexTimerStart(FtranDseClock);
   if (analysis->analyse_simplex_summary_data)
     analysis->operationRecordBefore(kSimplexNlaFtranDse, *DSE_Vector,
@@ -2227,6 +2250,7 @@ void HEkkDual::updatePivots() {
   //
   // If reinversion is needed then skip this method
   if (rebuild_reason) return;
+  HighsTraceScope trace("simplex", "UPDATE");
   // Transform the vectors used in updateFactor if the simplex NLA involves
   // scaling
   ekk_instance_.transformForUpdate(&col_aq, &row_ep, variable_in, &row_out);
@@ -44,6 +44,7 @@ class HEkkDual {
     if (!(ekk_instance_.info_.simplex_strategy == kSimplexStrategyDualPlain))
       initialiseInstanceParallel(simplex);
   }
+  ~HEkkDual();
 
   /**
    * @brief Solve a model instance
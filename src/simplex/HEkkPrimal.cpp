@@ -17,6 +17,7 @@
 #include "simplex/HEkkDual.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsSort.h"
+#include "util/HighsTrace.h"
 
 using std::min;
 
@@ -326,6 +327,16 @@ HighsStatus HEkkPrimal::solve(const bool pass_force_phase2) {
   return ekk_instance_.returnFromSolve(HighsStatus::kOk);
 }
 
+HEkkPrimal::~HEkkPrimal() {
+  HighsSimplexWorkspace& workspace = *ekk_instance_.workspace_;
+  workspace.release(col_aq);
+  workspace.release(row_ep);
+  workspace.release(row_ap);
+  workspace.release(col_basic_feasibility_change);
+  workspace.release(row_basic_feasibility_change);
+  workspace.release(col_steepest_edge);
+}
+
 void HEkkPrimal::initialiseInstance() {
   // Called in constructor for HEkkPrimal class
   analysis = &ekk_instance_.analysis_;
@@ -334,13 +345,14 @@ void HEkkPrimal::initialiseInstance() {
   num_row = ekk_instance_.lp_.num_row_;
   num_tot = num_col + num_row;
 
-  // Setup local vectors
-  col_aq.setup(num_row);
-  row_ep.setup(num_row);
-  row_ap.setup(num_col);
-  col_basic_feasibility_change.setup(num_row);
-  row_basic_feasibility_change.setup(num_col);
-  col_steepest_edge.setup(num_row);
+  // Setup local vectors, drawing their storage from the workspace
+  HighsSimplexWorkspace& workspace = *ekk_instance_.workspace_;
+  workspace.acquire(col_aq, num_row);
+  workspace.acquire(row_ep, num_row);
+  workspace.acquire(row_ap, num_col);
+  workspace.acquire(col_basic_feasibility_change, num_row);
+  workspace.acquire(row_basic_feasibility_change, num_col);
+  workspace.acquire(col_steepest_edge, num_row);
 
   ph1SorterR.reserve(num_row);
   ph1SorterT.reserve(num_row);
@@ -972,6 +984,7 @@ void HEkkPrimal::chuzc() {
 
 void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
   assert(!hyper_sparse || !done_next_chuzc);
+  HighsTraceScope trace("simplex", "CHUZC");
   const vector<int8_t>& nonbasicMove = ekk_instance_.basis_.nonbasicMove_;
   const vector<double>& workDual = ekk_instance_.info_.workDual_;
   double best_measure = 0;
@@ -1262,6 +1275,7 @@ void HEkkPrimal::phase1ChooseRow() {
 }
 
 void HEkkPrimal::chooseRow() {
+  HighsTraceScope trace("simplex", "CHUZR");
   HighsSimplexInfo& info = ekk_instance_.info_;
   const vector<double>& baseLower = info.baseLower_;
   const vector<double>& baseUpper = info.baseUpper_;
@@ -1417,6 +1431,7 @@ void HEkkPrimal::assessPivot() {
 
 void HEkkPrimal::update() {
   // Perform update operations that are independent of phase
+  HighsTraceScope trace("simplex", "UPDATE");
   HighsSimplexInfo& info = ekk_instance_.info_;
   assert(!rebuild_reason);
   bool flipped = row_out < 0;
@@ -30,6 +30,7 @@ const SimplexAlgorithm algorithm = SimplexAlgorithm::kPrimal;
 class HEkkPrimal {
  public:
   HEkkPrimal(HEkk& simplex) : ekk_instance_(simplex) { initialiseInstance(); }
+  ~HEkkPrimal();
   /**
    * @brief Solve a model instance
    */
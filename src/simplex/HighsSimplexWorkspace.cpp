@@ -0,0 +1,43 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file simplex/HighsSimplexWorkspace.cpp
+ * @brief
+ */
+#include "simplex/HighsSimplexWorkspace.h"
+
+void HighsSimplexWorkspace::acquire(HVector& vector, const HighsInt size) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!pool_.empty()) {
+      vector = std::move(pool_.back());
+      pool_.pop_back();
+    }
+  }
+  // HVector::setup resizes within the existing capacity when it can
+  vector.setup(size);
+}
+
+void HighsSimplexWorkspace::release(HVector& vector) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pool_.push_back(std::move(vector));
+  vector = HVector();
+}
+
+HighsInt HighsSimplexWorkspace::getNumPooled() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pool_.size();
+}
+
+void HighsSimplexWorkspace::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pool_.clear();
+  pool_.shrink_to_fit();
+}
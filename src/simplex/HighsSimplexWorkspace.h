@@ -0,0 +1,50 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file simplex/HighsSimplexWorkspace.h
+ * @brief Pool of HVectors for the simplex solvers
+ *
+ * The dual and primal simplex solvers are constructed for each solve,
+ * so would otherwise allocate and free their HVectors every time. By
+ * drawing them from a workspace that persists between solves, and can
+ * be shared by several HEkk instances, the vectors keep their storage:
+ * once the workspace has grown to fit the largest model, setting up a
+ * solver does no heap allocation. Pooled vectors never shrink.
+ */
+#ifndef SIMPLEX_HIGHSSIMPLEXWORKSPACE_H_
+#define SIMPLEX_HIGHSSIMPLEXWORKSPACE_H_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "util/HVector.h"
+
+class HighsSimplexWorkspace {
+ public:
+  // Set up vector for the given size, taking its storage from the
+  // pool if possible
+  void acquire(HVector& vector, const HighsInt size);
+
+  // Return the storage of vector to the pool, leaving vector empty
+  void release(HVector& vector);
+
+  // Number of vectors held by the pool
+  HighsInt getNumPooled();
+
+  // Free all pooled storage
+  void clear();
+
+ private:
+  std::mutex mutex_;
+  std::vector<HVector> pool_;
+};
+
+#endif /* SIMPLEX_HIGHSSIMPLEXWORKSPACE_H_ */
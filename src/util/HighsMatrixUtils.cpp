@@ -18,8 +18,76 @@
 #include <cmath>
 #include <cstdio>
 
+#include "parallel/HighsParallel.h"
 #include "util/HighsHash.h"
 
+// Number of nonzeros in a matrix for which indices and values are
+// checked in parallel
+const HighsInt kParallelAssessMinNz = 1 << 16;
+
+namespace {
+// Statistics on the entries of the matrix assessed by one thread
+struct AssessMatrixStats {
+  bool ok = true;
+  HighsInt num_large_values = 0;
+  double max_large_value = 0;
+  double min_large_value = kHighsInf;
+  std::vector<HighsInt> last_vec;
+};
+}  // namespace
+
+// Check the indices and values of a matrix in parallel, returning
+// true if none has to be reported or removed, other than values that
+// are too large, for which statistics are accumulated
+static bool assessMatrixEntriesParallel(
+    const HighsInt vec_dim, const HighsInt num_vec,
+    const vector<HighsInt>& matrix_start, const vector<HighsInt>& matrix_index,
+    const vector<double>& matrix_value, const double small_matrix_value,
+    const double large_matrix_value, HighsInt& num_large_values,
+    double& max_large_value, double& min_large_value) {
+  // Each thread has its own statistics and, to detect duplicate
+  // indices, its own record of the vector in which each index last
+  // occurred
+  std::vector<AssessMatrixStats> stats(highs::parallel::num_threads());
+  highs::parallel::for_each(
+      0, num_vec,
+      [&](HighsInt from_vec, HighsInt to_vec) {
+        AssessMatrixStats& local = stats[highs::parallel::thread_num()];
+        if (!local.ok) return;
+        if (local.last_vec.empty()) local.last_vec.assign(vec_dim, -1);
+        for (HighsInt ix = from_vec; ix < to_vec; ix++) {
+          for (HighsInt el = matrix_start[ix]; el < matrix_start[ix + 1];
+               el++) {
+            const HighsInt component = matrix_index[el];
+            const double abs_value = std::fabs(matrix_value[el]);
+            if (component < 0 || component >= vec_dim ||
+                local.last_vec[component] == ix ||
+                !(abs_value > small_matrix_value)) {
+              local.ok = false;
+              return;
+            }
+            local.last_vec[component] = ix;
+            if (abs_value >= large_matrix_value) {
+              local.max_large_value =
+                  std::max(abs_value, local.max_large_value);
+              local.min_large_value =
+                  std::min(abs_value, local.min_large_value);
+              local.num_large_values++;
+            }
+          }
+        }
+      },
+      std::max(HighsInt{1}, num_vec / (16 * highs::parallel::num_threads())));
+  for (const AssessMatrixStats& local : stats)
+    if (!local.ok) return false;
+  for (const AssessMatrixStats& local : stats) {
+    num_large_values += local.num_large_values;
+    max_large_value = std::max(local.max_large_value, max_large_value);
+    min_large_value = std::min(local.min_large_value, min_large_value);
+  }
+  return true;
+}
+
 HighsStatus assessMatrix(const HighsLogOptions& log_options,
                          const std::string matrix_name, const HighsInt vec_dim,
                          const HighsInt num_vec, vector<HighsInt>& matrix_start,
@@ -142,10 +210,22 @@ HighsStatus assessMatrix(
   HighsInt num_large_values = 0;
   double max_large_value = 0;
   double min_large_value = kHighsInf;
+  // For a large matrix, the indices and values are checked in
+  // parallel. Only if there are entries to report or remove is the
+  // serial pass below necessary
+  const bool entries_ok =
+      !partitioned && num_nz >= kParallelAssessMinNz &&
+      HighsTaskExecutor::isInitialized() &&
+      highs::parallel::num_threads() > 1 &&
+      assessMatrixEntriesParallel(
+          vec_dim, num_vec, matrix_start, matrix_index, matrix_value,
+          small_matrix_value, large_matrix_value, num_large_values,
+          max_large_value, min_large_value);
+  if (entries_ok) num_new_nz = num_nz;
   // Use index_map to identify duplicates.
   HighsHashTable<HighsInt> index_set;
 
-  for (HighsInt ix = 0; ix < num_vec; ix++) {
+  for (HighsInt ix = 0; ix < num_vec && !entries_ok; ix++) {
     HighsInt from_el = matrix_start[ix];
     HighsInt to_el = matrix_start[ix + 1];
     // Account for any index-value pairs removed so far
@@ -0,0 +1,229 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsTrace.cpp
+ * @brief
+ */
+#include "util/HighsTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct HighsTraceEvent {
+  const char* category;
+  const char* name;
+  int64_t start_time;
+  int64_t end_time;
+};
+
+// Events of one thread. Only the owning thread writes events, and
+// publishes them by incrementing num_recorded. While it is writing an
+// event, recording is set, so that stop() can wait until it's done.
+// Once the thread exits, the buffer can be taken by another thread
+struct HighsTraceBuffer {
+  explicit HighsTraceBuffer(const HighsInt id_)
+      : id(id_),
+        events(kHighsTraceBufferSize),
+        num_recorded(0),
+        recording(false),
+        in_use(true) {}
+  HighsInt id;
+  std::vector<HighsTraceEvent> events;
+  std::atomic<uint64_t> num_recorded;
+  std::atomic<bool> recording;
+  std::atomic<bool> in_use;
+};
+
+struct HighsTraceRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<HighsTraceBuffer>> buffers;
+  int64_t origin = 0;
+};
+
+HighsTraceRegistry& traceRegistry() {
+  static HighsTraceRegistry registry;
+  return registry;
+}
+
+struct HighsThreadTraceBuffer {
+  HighsTraceBuffer* buffer = nullptr;
+  ~HighsThreadTraceBuffer() {
+    if (buffer) buffer->in_use.store(false, std::memory_order_release);
+  }
+};
+
+thread_local HighsThreadTraceBuffer thread_trace_buffer;
+
+HighsTraceBuffer* threadTraceBuffer() {
+  if (thread_trace_buffer.buffer) return thread_trace_buffer.buffer;
+  HighsTraceRegistry& registry = traceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  HighsTraceBuffer* buffer = nullptr;
+  for (auto& free_buffer : registry.buffers) {
+    if (!free_buffer->in_use.load(std::memory_order_acquire)) {
+      buffer = free_buffer.get();
+      buffer->in_use.store(true, std::memory_order_relaxed);
+      break;
+    }
+  }
+  if (!buffer) {
+    registry.buffers.emplace_back(new HighsTraceBuffer(registry.buffers.size()));
+    buffer = registry.buffers.back().get();
+  }
+  thread_trace_buffer.buffer = buffer;
+  return buffer;
+}
+
+}  // namespace
+
+std::atomic<bool> HighsTrace::enabled_{false};
+std::atomic<bool> HighsTrace::owned_{false};
+
+bool HighsTrace::acquire() {
+  bool owned = false;
+  return owned_.compare_exchange_strong(owned, true);
+}
+
+void HighsTrace::release() { owned_.store(false); }
+
+void HighsTrace::start() {
+  clear();
+  HighsTraceRegistry& registry = traceRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.origin = now();
+  }
+  enabled_.store(true, std::memory_order_release);
+}
+
+void HighsTrace::stop() {
+  // Sequentially consistent, as is the store to recording in record(),
+  // so either a thread sees that recording has stopped, or it is seen
+  // to be recording here
+  enabled_.store(false);
+  HighsTraceRegistry& registry = traceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& buffer : registry.buffers)
+    while (buffer->recording.load(std::memory_order_acquire))
+      std::this_thread::yield();
+}
+
+void HighsTrace::clear() {
+  HighsTraceRegistry& registry = traceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& buffer : registry.buffers)
+    buffer->num_recorded.store(0, std::memory_order_release);
+}
+
+int64_t HighsTrace::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void HighsTrace::record(const char* category, const char* name,
+                        const int64_t start_time, const int64_t end_time) {
+  HighsTraceBuffer* buffer = threadTraceBuffer();
+  buffer->recording.store(true);
+  if (!enabled_.load()) {
+    buffer->recording.store(false, std::memory_order_release);
+    return;
+  }
+  const uint64_t num_recorded =
+      buffer->num_recorded.load(std::memory_order_relaxed);
+  HighsTraceEvent& event =
+      buffer->events[num_recorded % kHighsTraceBufferSize];
+  event.category = category;
+  event.name = name;
+  event.start_time = start_time;
+  event.end_time = end_time;
+  buffer->num_recorded.store(num_recorded + 1, std::memory_order_release);
+  buffer->recording.store(false, std::memory_order_release);
+}
+
+HighsInt HighsTrace::getNumEvents() {
+  HighsTraceRegistry& registry = traceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t num_event = 0;
+  for (auto& buffer : registry.buffers)
+    num_event += std::min(buffer->num_recorded.load(std::memory_order_acquire),
+                          uint64_t(kHighsTraceBufferSize));
+  return num_event;
+}
+
+void HighsTrace::writeChromeTrace(std::ostream& os) {
+  HighsTraceRegistry& registry = traceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  char line[256];
+  bool first = true;
+  auto writeLine = [&]() {
+    os << (first ? "\n" : ",\n") << line;
+    first = false;
+  };
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (auto& buffer : registry.buffers) {
+    const uint64_t num_recorded =
+        buffer->num_recorded.load(std::memory_order_acquire);
+    if (num_recorded == 0) continue;
+    snprintf(line, sizeof(line),
+             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+             "\"args\":{\"name\":\"HiGHS thread %d\"}}",
+             (int)buffer->id, (int)buffer->id);
+    writeLine();
+    const uint64_t from_event = num_recorded > uint64_t(kHighsTraceBufferSize)
+                                    ? num_recorded - kHighsTraceBufferSize
+                                    : 0;
+    for (uint64_t iEvent = from_event; iEvent < num_recorded; iEvent++) {
+      const HighsTraceEvent& event =
+          buffer->events[iEvent % kHighsTraceBufferSize];
+      // Chrome trace times are in microseconds
+      snprintf(line, sizeof(line),
+               "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+               "\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+               event.name, event.category,
+               1e-3 * (event.start_time - registry.origin),
+               1e-3 * (event.end_time - event.start_time), (int)buffer->id);
+      writeLine();
+    }
+  }
+  os << "\n]}\n";
+}
+
+bool HighsTrace::writeChromeTrace(const std::string& filename) {
+  std::ofstream file(filename);
+  if (!file) return false;
+  writeChromeTrace(file);
+  return bool(file);
+}
+
+HighsTraceFile::HighsTraceFile(const std::string& filename,
+                               const HighsLogOptions& log_options)
+    : log_options_(log_options) {
+  if (filename.empty() || !HighsTrace::acquire()) return;
+  filename_ = filename;
+  HighsTrace::start();
+}
+
+HighsTraceFile::~HighsTraceFile() {
+  if (filename_.empty()) return;
+  HighsTrace::stop();
+  if (!HighsTrace::writeChromeTrace(filename_))
+    highsLogUser(log_options_, HighsLogType::kWarning,
+                 "Unable to write trace file \"%s\"\n", filename_.c_str());
+  HighsTrace::release();
+}
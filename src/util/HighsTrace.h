@@ -0,0 +1,122 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsTrace.h
+ * @brief Timeline tracing of computational components in HiGHS
+ *
+ * Whereas HighsTimer accumulates the total time in each clock, tracing
+ * records the start and duration of individual events - a CHUZR, an
+ * INVERT, a MIP node - so that slow iterations and the overlap of
+ * threads can be seen. Each thread records into a ring buffer of its
+ * own, so recording takes no locks and the most recent
+ * kHighsTraceBufferSize events of each thread are kept. The events
+ * can be written in the Chrome trace JSON format, which is read by
+ * chrome://tracing and the Perfetto UI.
+ *
+ * Tracing is off unless started. When it is off, a HighsTraceScope
+ * costs a relaxed load of a flag. Since the events of all threads are
+ * recorded, tracing is owned by one caller at a time, which starts,
+ * stops and writes it, and its trace includes the events of any other
+ * solves running at the same time.
+ */
+#ifndef UTIL_HIGHSTRACE_H_
+#define UTIL_HIGHSTRACE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "io/HighsIO.h"
+#include "util/HighsInt.h"
+
+const HighsInt kHighsTraceBufferSize = 1 << 16;
+
+class HighsTrace {
+ public:
+  static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  // Take ownership of tracing, returning false if it's already owned
+  static bool acquire();
+
+  // Give up ownership of tracing
+  static void release();
+
+  // Discard any recorded events and start recording
+  static void start();
+
+  // Stop recording, keeping the events that have been recorded. Once
+  // it returns, no thread is recording an event
+  static void stop();
+
+  // Discard the recorded events
+  static void clear();
+
+  // Nanoseconds on the clock used for event times
+  static int64_t now();
+
+  // Record an event for the calling thread, unless recording has
+  // stopped. The category and name must be string literals, since only
+  // the pointers are kept
+  static void record(const char* category, const char* name,
+                     const int64_t start_time, const int64_t end_time);
+
+  // Number of events held over all threads
+  static HighsInt getNumEvents();
+
+  // Write the events in the Chrome trace JSON format. Events should
+  // not be recorded while they are being written
+  static void writeChromeTrace(std::ostream& os);
+  static bool writeChromeTrace(const std::string& filename);
+
+ private:
+  static std::atomic<bool> enabled_;
+  static std::atomic<bool> owned_;
+};
+
+// Records an event from its construction until it is stopped or
+// destroyed
+class HighsTraceScope {
+ public:
+  HighsTraceScope(const char* category, const char* name)
+      : category_(category),
+        name_(name),
+        start_time_(HighsTrace::isEnabled() ? HighsTrace::now() : -1) {}
+
+  ~HighsTraceScope() { stop(); }
+
+  void stop() {
+    if (start_time_ < 0) return;
+    HighsTrace::record(category_, name_, start_time_, HighsTrace::now());
+    start_time_ = -1;
+  }
+
+ private:
+  const char* category_;
+  const char* name_;
+  int64_t start_time_;
+};
+
+// Records events from construction until destruction, when they are
+// written to the Chrome trace file filename. Does nothing if filename
+// is empty or tracing is already owned, as for a solve within a solve
+// or solves running at the same time
+class HighsTraceFile {
+ public:
+  HighsTraceFile(const std::string& filename,
+                 const HighsLogOptions& log_options);
+  ~HighsTraceFile();
+
+ private:
+  std::string filename_;
+  const HighsLogOptions& log_options_;
+};
+
+#endif /* UTIL_HIGHSTRACE_H_ */
@@ -11,6 +11,8 @@
 #include "util/stringutil.h"
 
 #include <cassert>
+#include <cstdint>
+#include <cstdlib>
 
 void strRemoveWhitespace(char* str) {
   char* dest = str;
@@ -111,3 +113,59 @@ std::string first_word(std::string& str, size_t start) {
   assert(next_word_start != std::string::npos);
   return str.substr(next_word_start, next_word_end - next_word_start);
 }
+
+double strToDouble(const std::string& str) {
+  // A value with a decimal mantissa m < 2^53 and exponent |e| <= 22
+  // is m * 10^e or m / 10^-e, where both operands are exact doubles,
+  // so a single rounded multiplication or division gives the
+  // correctly rounded result. Anything else is left to strtod
+  const double kPower10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                             1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                             1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const uint64_t kMaxExactMantissa = uint64_t{1} << 53;
+  const char* c = str.c_str();
+  const bool negative = *c == '-';
+  if (*c == '-' || *c == '+') c++;
+  uint64_t mantissa = 0;
+  int num_digit = 0;
+  int exponent = 0;
+  bool mantissa_overflow = false;
+  auto addDigit = [&](const char digit) {
+    num_digit++;
+    if (mantissa_overflow) return;
+    mantissa = 10 * mantissa + (digit - '0');
+    if (mantissa > kMaxExactMantissa) mantissa_overflow = true;
+  };
+  for (; *c >= '0' && *c <= '9'; c++) addDigit(*c);
+  if (*c == '.') {
+    for (c++; *c >= '0' && *c <= '9'; c++) {
+      addDigit(*c);
+      exponent--;
+    }
+  }
+  if (num_digit == 0 || mantissa_overflow) return strtod(str.c_str(), NULL);
+  if (*c == 'e' || *c == 'E') {
+    c++;
+    const bool negative_exponent = *c == '-';
+    if (*c == '-' || *c == '+') c++;
+    if (!(*c >= '0' && *c <= '9')) return strtod(str.c_str(), NULL);
+    int exponent_value = 0;
+    for (; *c >= '0' && *c <= '9'; c++) {
+      if (exponent_value < 1000)
+        exponent_value = 10 * exponent_value + (*c - '0');
+    }
+    exponent += negative_exponent ? -exponent_value : exponent_value;
+  }
+  // Trailing characters, such as a hexadecimal or Fortran exponent,
+  // need strtod to decide what is parsed
+  if (*c != '\0') return strtod(str.c_str(), NULL);
+  double value = (double)mantissa;
+  if (mantissa != 0) {
+    if (exponent < -22 || exponent > 22) return strtod(str.c_str(), NULL);
+    if (exponent < 0)
+      value /= kPower10[-exponent];
+    else
+      value *= kPower10[exponent];
+  }
+  return negative ? -value : value;
+}
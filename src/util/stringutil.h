@@ -36,4 +36,9 @@ bool is_end(std::string& str, size_t end, const std::string& chars = non_chars);
 std::string first_word(std::string& str, size_t start);
 size_t first_word_end(std::string& str, size_t start);
 
+// Value of the number at the start of str, as given by atof, but
+// without the cost of strtod for the short decimal values that are
+// typical of model files
+double strToDouble(const std::string& str);
+
 #endif